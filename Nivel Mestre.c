@@ -1,61 +1,51 @@
+// nanosleep (trilha_sessao.h) é POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
-#define MAX_NOME 80
-#define MAX_PISTA 200
-#define HASH_SIZE 101   // tamanho da tabela hash (primo pequeno)
-
 // -----------------------------
-// Estruturas
+// Caso estático
+// O mapa, as pistas e a tabela pista -> suspeito são gerados em tempo de
+// compilação a partir de casos/mansao.txt:
+//   gerador_caso casos/mansao.txt caso_mansao.h CASO_MANSAO
+// Montar o caso não faz nenhuma alocação: as salas são índices em tabelas
+// somente leitura e a consulta de suspeitos usa uma hash perfeita.
+// Outros casos podem ser carregados sob demanda de casos/<nome>.txt pelo
+// catálogo (ver main()).
 // -----------------------------
+#include "caso.h"
+#include "caso_mansao.h"
+#include "catalogo_casos.h"
 
-// Struct: Sala
-// Representa um cômodo da mansão (nó da árvore binária).
-typedef struct Sala {
-    char nome[MAX_NOME];
-    char *pista;             // string alocada dinamicamente (NULL se não houver)
-    struct Sala *esquerda;
-    struct Sala *direita;
-} Sala;
-
-// Nó da BST que armazena pistas coletadas (sem duplicatas)
-typedef struct PistaNode {
-    char *pista;
-    struct PistaNode *esq;
-    struct PistaNode *dir;
-} PistaNode;
+#include "trilha_sessao.h"
 
-// Entradas da tabela hash (lista encadeada em cada bucket)
-typedef struct HashEntry {
-    char *chave;            // pista (key)
-    char *valor;            // suspeito (value)
-    struct HashEntry *prox;
-} HashEntry;
+#define DIRETORIO_CASOS "casos"
+#define ORCAMENTO_CATALOGO (1u << 20)   // 1 MiB de casos carregados
 
-// Tabela hash
-typedef struct HashTable {
-    HashEntry *buckets[HASH_SIZE];
-} HashTable;
+// -----------------------------
+// Motor do jogo (motor_jogo.h) com todos os recursos: pistas, suspeitos e
+// veredito. As escolhas e as pistas coletadas passam pela sessão (gravação
+// e repetição de trilhas, definidas mais abaixo) pelos ganchos do motor.
+// A ordem das pistas segue ORDEM_COLACAO (padrão 1: ordem do português;
+// compile com -DORDEM_COLACAO=0 para a ordem dos bytes).
+// -----------------------------
+struct Sessao;
+int sessaoEscolha(struct Sessao *s, char *opc);
+void sessaoPista(struct Sessao *s, uint32_t sala);
+#define MOTOR_LER_ESCOLHA(contexto, opc) sessaoEscolha((struct Sessao*) (contexto), (opc))
+#define MOTOR_PISTA_COLETADA(contexto, sala) sessaoPista((struct Sessao*) (contexto), (sala))
+// textos da exploração do Nível Mestre
+#define MOTOR_TXT_SALA "\nVocê está na sala: %s\n"
+#define MOTOR_TXT_SEM_PISTA "Nenhuma pista nova nesta sala.\n"
+#define MOTOR_TXT_SAIR " (s) Sair e ir ao julgamento\n"
+#include "motor_jogo.h"
 
 // -----------------------------
 // Funções utilitárias de string
 // -----------------------------
 
-// copiaString: aloca e retorna uma cópia da string (similar a strdup)
-char *copiaString(const char *s) {
-    if (!s) return NULL;
-    size_t n = strlen(s) + 1;
-    char *c = (char*) malloc(n);
-    if (!c) {
-        fprintf(stderr, "Erro: sem memória para copiar string.\n");
-        exit(EXIT_FAILURE);
-    }
-    memcpy(c, s, n);
-    return c;
-}
-
 // limpaEspaco: remove '\n' final de fgets (se houver)
 void limpaNovaLinha(char *s) {
     if (!s) return;
@@ -74,288 +64,134 @@ void leLinha(char *buffer, size_t tamanho) {
 }
 
 // -----------------------------
-// criarSala()
-// Cria dinamicamente um cômodo (Sala) com nome e pista opcional.
+// Sessão: gravação e repetição (trilha_sessao.h)
+// Todas as entradas do jogador passam por aqui. Gravando, cada escolha,
+// pista coletada e acusação vira um evento da trilha. Repetindo, as entradas
+// vêm da trilha e cada resultado é conferido com o que foi gravado; as
+// diferenças são contadas em 'divergencias'.
 // -----------------------------
-Sala* criarSala(const char *nome, const char *pista) {
-    Sala *s = (Sala*) malloc(sizeof(Sala));
-    if (!s) {
-        fprintf(stderr, "Erro ao alocar memória para Sala.\n");
-        exit(EXIT_FAILURE);
+typedef struct Sessao {
+    TrilhaGravador gravador;
+    int gravando;
+    const Trilha *trilha;       // não NULL: repetição
+    size_t proximo;             // próximo evento da trilha
+    int ritmo;                  // repete com os intervalos gravados
+    uint64_t inicio;            // relógio da repetição
+    int divergencias;
+} Sessao;
+
+// sessaoEsperado: (repetição) consome o próximo evento, que deve ser do tipo indicado
+static const TrilhaEvento *sessaoEsperado(Sessao *s, int tipo) {
+    const Trilha *t = s->trilha;
+    if (s->proximo >= t->numEventos || t->eventos[s->proximo].tipo != tipo) {
+        fprintf(stderr, "Divergência: evento %zu deveria ser do tipo %d.\n", s->proximo, tipo);
+        s->divergencias++;
+        return NULL;
     }
-    strncpy(s->nome, nome, MAX_NOME - 1);
-    s->nome[MAX_NOME - 1] = '\0';
-    if (pista != NULL && strlen(pista) > 0) {
-        s->pista = copiaString(pista);
-    } else {
-        s->pista = NULL;
+    const TrilhaEvento *e = &t->eventos[s->proximo++];
+    if (s->ritmo) {
+        uint64_t decorrido = trilhaAgora() - s->inicio;
+        if (e->tempo > decorrido) trilhaEspera(e->tempo - decorrido);
     }
-    s->esquerda = s->direita = NULL;
-    return s;
+    return e;
 }
 
-// -----------------------------
-// BST: inserirPista()
-// Insere uma pista na BST de pistas coletadas em ordem alfabética.
-// Evita duplicatas (se já existe, não insere).
-// Retorna a raiz (possivelmente nova).
-// -----------------------------
-PistaNode* inserirPista(PistaNode *raiz, const char *pista) {
-    if (pista == NULL) return raiz;
-    if (raiz == NULL) {
-        PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode));
-        if (!n) {
-            fprintf(stderr, "Erro ao alocar nó de pista.\n");
-            exit(EXIT_FAILURE);
-        }
-        n->pista = copiaString(pista);
-        n->esq = n->dir = NULL;
-        return n;
-    }
-    int cmp = strcmp(pista, raiz->pista);
-    if (cmp < 0) raiz->esq = inserirPista(raiz->esq, pista);
-    else if (cmp > 0) raiz->dir = inserirPista(raiz->dir, pista);
-    // else: igual => duplicata; não inserir
-    return raiz;
+static void sessaoDivergencia(Sessao *s, const char *oque, const TrilhaEvento *e) {
+    fprintf(stderr, "Divergência no evento %zu (%s).\n", (size_t)(e - s->trilha->eventos), oque);
+    s->divergencias++;
 }
 
-// -----------------------------
-// exibirPistas()
-// Imprime as pistas coletadas (in-order traversal => ordem alfabética)
-// -----------------------------
-void exibirPistas(PistaNode *raiz) {
-    if (raiz == NULL) return;
-    exibirPistas(raiz->esq);
-    printf(" - %s\n", raiz->pista);
-    exibirPistas(raiz->dir);
+// sessaoEscolha: lê a tecla de navegação (1 = lida, 0 = entrada inválida)
+int sessaoEscolha(Sessao *s, char *opc) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_ESCOLHA);
+        *opc = e ? (char) e->valor : 's';   // trilha acabou ou divergiu: encerra a exploração
+        return 1;
+    }
+    if (scanf(" %c", opc) != 1) return 0;
+    if (s->gravando) {
+        TrilhaEvento e = { TRILHA_ESCOLHA, 0, (unsigned char) *opc, 0, NULL };
+        trilhaGravar(&s->gravador, &e);
+    }
+    return 1;
 }
 
-// -----------------------------
-// liberarPistas()
-// Libera memória da BST de pistas
-// -----------------------------
-void liberarPistas(PistaNode *raiz) {
-    if (!raiz) return;
-    liberarPistas(raiz->esq);
-    liberarPistas(raiz->dir);
-    free(raiz->pista);
-    free(raiz);
+// sessaoPista: registra (ou confere) a coleta da pista de uma sala
+void sessaoPista(Sessao *s, uint32_t sala) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_PISTA);
+        if (e && e->valor != sala) sessaoDivergencia(s, "pista coletada", e);
+    } else if (s->gravando) {
+        TrilhaEvento e = { TRILHA_PISTA, 0, sala, 0, NULL };
+        trilhaGravar(&s->gravador, &e);
+    }
 }
 
-// -----------------------------
-// Hash: funções básicas
-// -----------------------------
+// sessaoPistasFinais: registra (ou confere) quantidade e resumo das pistas coletadas
+typedef struct ResumoPistas {
+    uint64_t quantidade;
+    uint64_t soma;
+} ResumoPistas;
 
-// função hash simples (djb2)
-static unsigned long hashString(const char *str) {
-    unsigned long hash = 5381;
-    int c;
-    while ((c = (unsigned char)*str++) != 0) hash = ((hash << 5) + hash) + c;
-    return hash % HASH_SIZE;
+void somaResumoPista(void *no, void *contexto) {
+    ResumoPistas *r = (ResumoPistas*) contexto;
+    r->quantidade++;
+    r->soma += trilhaResumoTexto(((PistaNode*) no)->pista);
 }
 
-// inicializa tabela hash (zera buckets)
-void inicializaHash(HashTable *ht) {
-    for (int i = 0; i < HASH_SIZE; ++i) ht->buckets[i] = NULL;
-}
-
-// inserirNaHash()
-// Insere associação pista -> suspeito na tabela hash.
-// Se já existir a chave, sobrescreve o valor.
-// -----------------------------
-void inserirNaHash(HashTable *ht, const char *pista, const char *suspeito) {
-    if (!pista || !suspeito) return;
-    unsigned long idx = hashString(pista);
-    HashEntry *e = ht->buckets[idx];
-    while (e) {
-        if (strcmp(e->chave, pista) == 0) {
-            // já existe: atualizar valor
-            free(e->valor);
-            e->valor = copiaString(suspeito);
-            return;
-        }
-        e = e->prox;
-    }
-    // não achou: cria novo entry e insere no início
-    HashEntry *novo = (HashEntry*) malloc(sizeof(HashEntry));
-    if (!novo) {
-        fprintf(stderr, "Erro ao alocar hash entry.\n");
-        exit(EXIT_FAILURE);
+void sessaoPistasFinais(Sessao *s, PistaNode *arvorePistas) {
+    if (!s->trilha && !s->gravando) return;
+    ResumoPistas r = { 0, 0 };
+    arvoreEmOrdem(arvorePistas, ARVORE_FILHOS(PistaNode, esq, dir), somaResumoPista, &r);
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_PISTAS_FINAIS);
+        if (e && (e->valor != r.quantidade || e->extra != r.soma)) sessaoDivergencia(s, "pistas coletadas", e);
+    } else {
+        TrilhaEvento e = { TRILHA_PISTAS_FINAIS, 0, r.quantidade, r.soma, NULL };
+        trilhaGravar(&s->gravador, &e);
     }
-    novo->chave = copiaString(pista);
-    novo->valor = copiaString(suspeito);
-    novo->prox = ht->buckets[idx];
-    ht->buckets[idx] = novo;
 }
 
-// encontrarSuspeito()
-// Consulta a tabela hash retornando o suspeito associado a uma pista.
-// Retorna NULL se não houver associação.
-// Nota: retorna ponteiro interno; NÃO deve ser liberado pelo chamador.
-// -----------------------------
-const char* encontrarSuspeito(HashTable *ht, const char *pista) {
-    if (!pista) return NULL;
-    unsigned long idx = hashString(pista);
-    HashEntry *e = ht->buckets[idx];
-    while (e) {
-        if (strcmp(e->chave, pista) == 0) return e->valor;
-        e = e->prox;
+// sessaoAcusacao: lê o nome acusado
+void sessaoAcusacao(Sessao *s, char *entrada, size_t tamanho) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_ACUSACAO);
+        snprintf(entrada, tamanho, "%s", e ? e->texto : "");
+        return;
     }
-    return NULL;
-}
-
-// liberarHash()
-// Libera todas as entradas da tabela hash
-// -----------------------------
-void liberarHash(HashTable *ht) {
-    for (int i = 0; i < HASH_SIZE; ++i) {
-        HashEntry *e = ht->buckets[i];
-        while (e) {
-            HashEntry *tmp = e;
-            e = e->prox;
-            free(tmp->chave);
-            free(tmp->valor);
-            free(tmp);
-        }
-        ht->buckets[i] = NULL;
+    // limpar buffer remanescente
+    int ch;
+    while ((ch = getchar()) != '\n' && ch != EOF);
+    leLinha(entrada, tamanho);
+    if (s->gravando) {
+        TrilhaEvento e = { TRILHA_ACUSACAO, 0, 0, 0, entrada };
+        trilhaGravar(&s->gravador, &e);
     }
 }
 
-// -----------------------------
-// explorarSalas()
-// Navega interativamente pela árvore de salas, coleta pistas automaticamente
-// e as adiciona na BST de pistas coletadas.
-// -----------------------------
-void explorarSalas(Sala *atual, PistaNode **arvorePistas) {
-    if (!atual) return;
-    char opc;
-    Sala *pos = atual;
-
-    while (pos != NULL) {
-        printf("\nVocê está na sala: %s\n", pos->nome);
-
-        // Se existir pista, coleta automaticamente (insere na BST e marca coletada)
-        if (pos->pista != NULL) {
-            printf("Pista encontrada: \"%s\"\n", pos->pista);
-            *arvorePistas = inserirPista(*arvorePistas, pos->pista);
-            // Marca como coletada liberando a string
-            free(pos->pista);
-            pos->pista = NULL;
-        } else {
-            printf("Nenhuma pista nova nesta sala.\n");
-        }
-
-        // Mostra opções
-        printf("\nOpções:\n");
-        if (pos->esquerda) printf(" (e) Ir para %s (esquerda)\n", pos->esquerda->nome);
-        if (pos->direita)  printf(" (d) Ir para %s (direita)\n", pos->direita->nome);
-        printf(" (s) Sair e ir ao julgamento\n");
-        printf("Escolha: ");
-
-        if (scanf(" %c", &opc) != 1) {
-            int ch;
-            while ((ch = getchar()) != '\n' && ch != EOF);
-            printf("Entrada inválida. Tente novamente.\n");
-            continue;
-        }
-
-        if (opc == 'e' || opc == 'E') {
-            if (pos->esquerda) pos = pos->esquerda;
-            else printf("Não há caminho à esquerda.\n");
-        } else if (opc == 'd' || opc == 'D') {
-            if (pos->direita) pos = pos->direita;
-            else printf("Não há caminho à direita.\n");
-        } else if (opc == 's' || opc == 'S') {
-            printf("Exploração encerrada pelo jogador.\n");
-            break;
-        } else {
-            printf("Opção inválida. Use 'e', 'd' ou 's'.\n");
-        }
+// sessaoVeredito: registra (ou confere) evidências, veredito e suspeito considerado
+void sessaoVeredito(Sessao *s, int contador, int veredito, const char *suspeito) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_VEREDITO);
+        if (e && (e->valor != (uint64_t) contador || e->extra != (uint64_t) veredito ||
+                  strcmp(e->texto, suspeito) != 0)) sessaoDivergencia(s, "veredito", e);
+    } else if (s->gravando) {
+        TrilhaEvento e = { TRILHA_VEREDITO, 0, (uint64_t) contador, (uint64_t) veredito, (char*) suspeito };
+        trilhaGravar(&s->gravador, &e);
     }
 }
 
 // -----------------------------
-// verificarSuspeitoFinal()
-// Avalia se existem pelo menos 'limite' pistas coletadas que apontam para o suspeito indicado.
-// Percorre a BST de pistas coletadas e conta quantas correspondem ao suspeito consultando a hash.
-// Retorna o número de pistas que apontam para o suspeito.
-// -----------------------------
-typedef struct ContadorCtx {
-    HashTable *ht;
-    const char *suspeito;
-    int contador;
-} ContadorCtx;
-
-void contarCallback(PistaNode *n, ContadorCtx *ctx) {
-    if (!n || !ctx) return;
-    const char *s = encontrarSuspeito(ctx->ht, n->pista);
-    if (s && strcmp(s, ctx->suspeito) == 0) ctx->contador += 1;
-}
-
-// percorre BST in-order e aplica callback (recursivo)
-void percorreBST_e_conta(PistaNode *raiz, ContadorCtx *ctx) {
-    if (!raiz) return;
-    percorreBST_e_conta(raiz->esq, ctx);
-    contarCallback(raiz, ctx);
-    percorreBST_e_conta(raiz->dir, ctx);
-}
-
-// -----------------------------
-// liberarSalas()
-// Libera memória da árvore de salas (inclui liberação de pistas que ainda existirem)
-// -----------------------------
-void liberarSalas(Sala *raiz) {
-    if (!raiz) return;
-    liberarSalas(raiz->esquerda);
-    liberarSalas(raiz->direita);
-    if (raiz->pista) free(raiz->pista);
-    free(raiz);
-}
-
-// -----------------------------
-// Função principal
-// Monta o mapa, preenche a hash com associações (pista -> suspeito), realiza exploração,
-// exibe pistas coletadas, pede acusação e verifica evidências.
+// jogarSessao()
+// Uma partida completa: exploração, pistas coletadas, acusação e veredito.
+// As entradas e resultados passam pela sessão (gravação ou repetição).
 // -----------------------------
-int main(void) {
-    // ---------- Montagem do mapa (árvore fixa) ----------
-    Sala *hall = criarSala("Hall de Entrada", "Bilhete rasgado com hora marcada");
-    Sala *salaEstar = criarSala("Sala de Estar", "Pegadas molhadas perto da lareira");
-    Sala *cozinha = criarSala("Cozinha", "Faca com monograma X");
-    Sala *biblioteca = criarSala("Biblioteca", "Livro apontando para passagem secreta");
-    Sala *jardim = criarSala("Jardim", "Foto antiga da família com uma assinatura");
-    Sala *pirao = criarSala("Porão", "Raspas de tinta da mesma cor da mansão");
-    Sala *escritorio = criarSala("Escritório", "Carta com assinatura parcial");
-    Sala *sotao = criarSala("Sótão", "Chave enferrujada com iniciais 'M.'");
-
-    // conexões
-    hall->esquerda = salaEstar;
-    hall->direita  = cozinha;
-
-    salaEstar->esquerda = biblioteca;
-    salaEstar->direita  = jardim;
-
-    cozinha->esquerda = pirao;
-    cozinha->direita  = escritorio;
-
-    biblioteca->esquerda = sotao;
-
-    // ---------- Cria e popula a tabela hash (pista -> suspeito) ----------
-    HashTable ht;
-    inicializaHash(&ht);
-
-    // Associações pré-definidas (definidas pela lógica do jogo)
-    inserirNaHash(&ht, "Bilhete rasgado com hora marcada", "Suspeito A");
-    inserirNaHash(&ht, "Pegadas molhadas perto da lareira", "Suspeito B");
-    inserirNaHash(&ht, "Faca com monograma X", "Suspeito C");
-    inserirNaHash(&ht, "Livro apontando para passagem secreta", "Suspeito A");
-    inserirNaHash(&ht, "Foto antiga da família com uma assinatura", "Suspeito B");
-    inserirNaHash(&ht, "Raspas de tinta da mesma cor da mansão", "Suspeito C");
-    inserirNaHash(&ht, "Carta com assinatura parcial", "Suspeito A");
-    inserirNaHash(&ht, "Chave enferrujada com iniciais 'M.'", "Suspeito D");
-
-    // ---------- BST de pistas coletadas (inicialmente vazia) ----------
-    PistaNode *arvorePistas = NULL;
+void jogarSessao(const Caso *caso, Sessao *sessao) {
+    // ---------- Mapa do caso (sem cópia) e BST de pistas coletadas (vazia) ----------
+    Mapa mapa = mapaDoCaso(caso);
+    Jogo jogo;
+    jogoInicializar(&jogo, &mapa);
+    jogo.caso = caso;
 
     // ---------- Início do jogo ----------
     printf("=========================================\n");
@@ -364,50 +200,145 @@ int main(void) {
     printf("Explore a mansão e colete pistas. Ao final, acuse o suspeito.\n");
     printf("Navegue com: 'e' (esquerda), 'd' (direita) ou 's' (sair).\n");
 
-    explorarSalas(hall, &arvorePistas);
+    explorarSalas(&jogo, sessao);
+    sessaoPistasFinais(sessao, jogo.pistas);
 
     // Exibe pistas coletadas
     printf("\n\n===== PISTAS COLETADAS =====\n");
-    if (arvorePistas == NULL) {
+    if (jogo.pistas == NULL) {
         printf("Nenhuma pista coletada.\n");
     } else {
-        exibirPistas(arvorePistas);
+        exibirPistas(jogo.pistas);
     }
 
-    // Solicita acusação do jogador
+    // Solicita acusação do jogador e aplica a regra do veredito
     char entrada[128];
     printf("\nDigite o nome do suspeito que você deseja acusar (ex.: Suspeito A):\n> ");
-    // limpar buffer remanescente
-    int ch;
-    while ((ch = getchar()) != '\n' && ch != EOF);
-    leLinha(entrada, sizeof(entrada));
-    if (strlen(entrada) == 0) {
-        printf("Nenhum suspeito informado. Encerrando.\n");
-    } else {
-        // Conta quantas pistas coletadas apontam para o suspeito indicado
-        ContadorCtx ctx;
-        ctx.ht = &ht;
-        ctx.suspeito = copiaString(entrada); // cópia para segurança
-        ctx.contador = 0;
+    sessaoAcusacao(sessao, entrada, sizeof(entrada));
+    Julgamento julgamento;
+    julgarAcusacao(&jogo, entrada, &julgamento);
+    sessaoVeredito(sessao, julgamento.evidencias, julgamento.veredito, julgamento.suspeito);
 
-        percorreBST_e_conta(arvorePistas, &ctx);
+    // ---------- Limpeza de memória ----------
+    liberarJogo(&jogo);
+}
 
-        printf("\nVocê acusou: %s\n", ctx.suspeito);
-        printf("Evidências encontradas que apontam para %s: %d\n", ctx.suspeito, ctx.contador);
+// -----------------------------
+// Função principal
+// Usa o caso estático ou o caso pedido na linha de comando (mapa + hash
+// pista -> suspeito) e joga uma partida, gravando-a se pedido:
+//   Nivel Mestre [caso] [--gravar trilha.dqt]
+// Ou repete uma trilha gravada (mesmo caso da gravação), conferindo pistas e
+// veredito; a saída do jogo vai para stdout e o resumo para stderr:
+//   Nivel Mestre --repetir trilha.dqt [--ritmo] [--vezes N]
+// --ritmo respeita os intervalos gravados; sem ele a repetição é a toda velocidade.
+// -----------------------------
+int main(int argc, char **argv) {
+    const char *nomeCaso = NULL, *gravar = NULL, *repetir = NULL;
+    int ritmo = 0;
+    long vezes = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--gravar") == 0 && i + 1 < argc) gravar = argv[++i];
+        else if (strcmp(argv[i], "--repetir") == 0 && i + 1 < argc) repetir = argv[++i];
+        else if (strcmp(argv[i], "--vezes") == 0 && i + 1 < argc) vezes = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--ritmo") == 0) ritmo = 1;
+        else if (argv[i][0] != '-' && !nomeCaso) nomeCaso = argv[i];
+        else {
+            fprintf(stderr, "Uso: %s [caso] [--gravar trilha]\n"
+                            "     %s --repetir trilha [--ritmo] [--vezes N]\n", argv[0], argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (vezes < 1) vezes = 1;
+
+    // ---------- Trilha a repetir (define o caso) ----------
+    Trilha trilha;
+    if (repetir) {
+        FILE *f = fopen(repetir, "rb");
+        char erro[128];
+        if (!f) {
+            fprintf(stderr, "Erro: não foi possível abrir a trilha '%s'.\n", repetir);
+            return EXIT_FAILURE;
+        }
+        int r = trilhaCarregar(f, &trilha, erro, sizeof(erro));
+        fclose(f);
+        if (r != 0) {
+            fprintf(stderr, "Erro na trilha '%s': %s.\n", repetir, erro);
+            return EXIT_FAILURE;
+        }
+        nomeCaso = trilha.nomeCaso[0] ? trilha.nomeCaso : NULL;
+    }
 
-        if (ctx.contador >= 2) {
-            printf("\nResultado: ACUSAÇÃO SUSTENTADA. Parece que você tem evidências suficientes!\n");
-        } else {
-            printf("\nResultado: ACUSAÇÃO FRACA. Poucas evidências. Falta prova contundente.\n");
+    // ---------- Mapa e tabela pista -> suspeito ----------
+    // Sem nome de caso, ambos vêm de caso_mansao.h (tabelas estáticas): nenhuma alocação aqui.
+    // Com um nome de caso, ele é carregado de casos/<nome>.txt pelo catálogo.
+    const Caso *caso = &CASO_MANSAO;
+    Catalogo catalogo;
+    CatalogoCaso *casoAberto = NULL;
+    if (nomeCaso) {
+        catalogoInicializar(&catalogo, ORCAMENTO_CATALOGO, catalogoCarregadorArquivos, (void*) DIRETORIO_CASOS);
+        casoAberto = catalogoAbrir(&catalogo, nomeCaso);
+        if (!casoAberto) {
+            fprintf(stderr, "Erro: caso '%s' não encontrado em %s/.\n", nomeCaso, DIRETORIO_CASOS);
+            catalogoLiberar(&catalogo);
+            if (repetir) trilhaLiberar(&trilha);
+            return EXIT_FAILURE;
         }
-        free((char*)ctx.suspeito);
+        caso = casoAberto->caso;
     }
 
-    // ---------- Limpeza de memória ----------
-    liberarPistas(arvorePistas);
-    liberarHash(&ht);
-    liberarSalas(hall);
+    Sessao sessao;
+    memset(&sessao, 0, sizeof(sessao));
+    int status = EXIT_SUCCESS;
+    if (repetir) {
+        // ---------- Repetição ----------
+        sessao.trilha = &trilha;
+        sessao.ritmo = ritmo;
+        uint64_t t0 = trilhaAgora();
+        for (long v = 0; v < vezes; ++v) {
+            sessao.proximo = 0;
+            sessao.inicio = trilhaAgora();
+            jogarSessao(caso, &sessao);
+            if (sessao.proximo != trilha.numEventos) {
+                fprintf(stderr, "Divergência: %zu eventos da trilha não foram usados.\n",
+                        trilha.numEventos - sessao.proximo);
+                sessao.divergencias++;
+            }
+        }
+        double total = (double)(trilhaAgora() - t0);
+        double gravado = trilha.numEventos ? (double) trilha.eventos[trilha.numEventos - 1].tempo : 0.0;
+        fprintf(stderr, "\nrepetição de %s: %ld vez(es), %zu eventos cada, %s\n", repetir, vezes,
+                trilha.numEventos, ritmo ? "no ritmo gravado" : "a toda velocidade");
+        fprintf(stderr, "tempo: %.3f ms por sessão (gravada em %.3f ms), %.1f eventos/s\n",
+                total / vezes / 1000.0, gravado / 1000.0, total > 0 ? trilha.numEventos * vezes * 1e6 / total : 0.0);
+        fprintf(stderr, "conferência: %s (%d divergência(s))\n",
+                sessao.divergencias ? "FALHOU" : "pistas e veredito conferem", sessao.divergencias);
+        if (sessao.divergencias) status = EXIT_FAILURE;
+        trilhaLiberar(&trilha);
+    } else {
+        // ---------- Partida (opcionalmente gravada) ----------
+        FILE *saida = NULL;
+        if (gravar) {
+            saida = fopen(gravar, "wb");
+            if (!saida) {
+                fprintf(stderr, "Erro: não foi possível criar a trilha '%s'.\n", gravar);
+                status = EXIT_FAILURE;
+            } else {
+                trilhaGravadorAbrir(&sessao.gravador, saida, nomeCaso ? nomeCaso : "");
+                sessao.gravando = 1;
+            }
+        }
+        if (status == EXIT_SUCCESS) jogarSessao(caso, &sessao);
+        if (saida && fclose(saida) != 0) {
+            fprintf(stderr, "Erro ao gravar a trilha '%s'.\n", gravar);
+            status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS) printf("\nObrigado por jogar Detective Quest - Modo Mestre!\n");
+    }
 
-    printf("\nObrigado por jogar Detective Quest - Modo Mestre!\n");
-    return 0;
+    if (casoAberto) {
+        catalogoFechar(&catalogo, casoAberto);
+        catalogoLiberar(&catalogo);
+    }
+    return status;
 }
@@ -2,111 +2,45 @@
 #include <stdlib.h>
 #include <string.h>
 
-// Estrutura que representa uma sala da mansão
-typedef struct Sala {
-    char nome[50];
-    struct Sala* esquerda;  // Caminho à esquerda
-    struct Sala* direita;   // Caminho à direita
-} Sala;
-
-//------------------------------------------------------
-// Função: criarSala()
-// Cria dinamicamente uma sala com um nome informado
-//------------------------------------------------------
-Sala* criarSala(const char* nome) {
-    Sala* novaSala = (Sala*) malloc(sizeof(Sala));
-    if (novaSala == NULL) {
-        printf("Erro ao alocar memória para a sala.\n");
-        exit(1);
-    }
-    strcpy(novaSala->nome, nome);
-    novaSala->esquerda = NULL;
-    novaSala->direita = NULL;
-    return novaSala;
-}
-
-//------------------------------------------------------
-// Função: explorarSalas()
-// Permite que o jogador explore a mansão
-//------------------------------------------------------
-void explorarSalas(Sala* salaAtual) {
-    char escolha;
-
-    while (salaAtual != NULL) {
-        printf("\nVocê está na: %s\n", salaAtual->nome);
-
-        // Caso a sala não tenha saídas (nó-folha)
-        if (salaAtual->esquerda == NULL && salaAtual->direita == NULL) {
-            printf("Você chegou ao fim do caminho!\n");
-            break;
-        }
-
-        printf("Escolha o caminho:\n");
-        if (salaAtual->esquerda != NULL)
-            printf(" (e) Ir para %s à esquerda\n", salaAtual->esquerda->nome);
-        if (salaAtual->direita != NULL)
-            printf(" (d) Ir para %s à direita\n", salaAtual->direita->nome);
-        printf(" (s) Sair do jogo\n");
-        printf("Digite sua opção: ");
-        scanf(" %c", &escolha);
-
-        if (escolha == 'e' || escolha == 'E') {
-            if (salaAtual->esquerda != NULL)
-                salaAtual = salaAtual->esquerda;
-            else
-                printf("Não há caminho à esquerda!\n");
-        }
-        else if (escolha == 'd' || escolha == 'D') {
-            if (salaAtual->direita != NULL)
-                salaAtual = salaAtual->direita;
-            else
-                printf("Não há caminho à direita!\n");
-        }
-        else if (escolha == 's' || escolha == 'S') {
-            printf("Você decidiu encerrar a exploração.\n");
-            break;
-        }
-        else {
-            printf("Opção inválida! Tente novamente.\n");
-        }
-    }
-}
-
-//------------------------------------------------------
-// Função: liberarSalas()
-// Libera a memória da árvore binária recursivamente
-//------------------------------------------------------
-void liberarSalas(Sala* raiz) {
-    if (raiz != NULL) {
-        liberarSalas(raiz->esquerda);
-        liberarSalas(raiz->direita);
-        free(raiz);
-    }
-}
+// Nível Novato: só o mapa. Sem pistas, suspeitos ou veredito, a Sala do
+// motor tem apenas nome e saídas (ver motor_jogo.h).
+#define MOTOR_PISTAS 0
+#define MOTOR_SUSPEITOS 0
+#define MOTOR_VEREDITO 0
+// textos da exploração do Nível Novato
+#define MOTOR_TXT_SALA "\nVocê está na: %s\n"
+#define MOTOR_TXT_OPCOES "Escolha o caminho:\n"
+#define MOTOR_TXT_ESQUERDA " (e) Ir para %s à esquerda\n"
+#define MOTOR_TXT_DIREITA " (d) Ir para %s à direita\n"
+#define MOTOR_TXT_SAIR " (s) Sair do jogo\n"
+#define MOTOR_TXT_PROMPT "Digite sua opção: "
+#define MOTOR_TXT_SEM_ESQUERDA "Não há caminho à esquerda!\n"
+#define MOTOR_TXT_SEM_DIREITA "Não há caminho à direita!\n"
+#define MOTOR_TXT_ENCERRADA "Você decidiu encerrar a exploração.\n"
+#define MOTOR_TXT_OPCAO_INVALIDA "Opção inválida! Tente novamente.\n"
+#include "motor_jogo.h"
 
 //------------------------------------------------------
 // Função principal: main()
 // Monta o mapa da mansão e inicia o jogo
 //------------------------------------------------------
 int main() {
-    // Criação das salas (árvore fixa)
-    Sala* hallEntrada = criarSala("Hall de Entrada");
-    Sala* salaEstar   = criarSala("Sala de Estar");
-    Sala* cozinha     = criarSala("Cozinha");
-    Sala* biblioteca  = criarSala("Biblioteca");
-    Sala* jardim      = criarSala("Jardim");
-    Sala* porao       = criarSala("Porão");
-    Sala* escritorio  = criarSala("Escritório");
+    Mapa mapa;
+    mapaInicializar(&mapa);
+
+    // Criação das salas (árvore fixa; a primeira é a entrada)
+    uint32_t hallEntrada = criarSala(&mapa, "Hall de Entrada");
+    uint32_t salaEstar   = criarSala(&mapa, "Sala de Estar");
+    uint32_t cozinha     = criarSala(&mapa, "Cozinha");
+    uint32_t biblioteca  = criarSala(&mapa, "Biblioteca");
+    uint32_t jardim      = criarSala(&mapa, "Jardim");
+    uint32_t porao       = criarSala(&mapa, "Porão");
+    uint32_t escritorio  = criarSala(&mapa, "Escritório");
 
     // Montagem manual da árvore binária
-    hallEntrada->esquerda = salaEstar;
-    hallEntrada->direita  = cozinha;
-
-    salaEstar->esquerda   = biblioteca;
-    salaEstar->direita    = jardim;
-
-    cozinha->esquerda     = porao;
-    cozinha->direita      = escritorio;
+    ligarSalas(&mapa, hallEntrada, salaEstar, cozinha);
+    ligarSalas(&mapa, salaEstar, biblioteca, jardim);
+    ligarSalas(&mapa, cozinha, porao, escritorio);
 
     // Início do jogo
     printf("====================================\n");
@@ -114,10 +48,11 @@ int main() {
     printf("====================================\n");
     printf("Você começa sua investigação...\n");
 
-    explorarSalas(hallEntrada);
+    Jogo jogo = { &mapa };
+    explorarSalas(&jogo, NULL);
 
     // Libera a memória alocada
-    liberarSalas(hallEntrada);
+    liberarSalas(&mapa);
 
     printf("\nObrigado por jogar Detective Quest!\n");
     return 0;
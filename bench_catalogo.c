@@ -0,0 +1,153 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "catalogo_casos.h"
+
+// -----------------------------
+// bench_catalogo.c
+// Mede o catálogo de casos (catalogo_casos.h) com acessos que seguem uma
+// distribuição de Zipf: poucos casos muito populares e uma cauda longa.
+// Cada acesso abre um caso para uma "sessão"; há um número fixo de sessões
+// simultâneas e a mais antiga é fechada quando uma nova começa.
+//
+// Uso: bench_catalogo [numCasos] [numAcessos] [expoenteZipf]
+//   compilar: gcc -O2 bench_catalogo.c -o bench_catalogo -lm
+// -----------------------------
+
+#define SESSOES_ATIVAS 32
+
+// gerador pseudoaleatório (xorshift64*) para resultados reproduzíveis
+static unsigned long long estado = 88172645463325252ULL;
+static double aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return (double)((estado * 2685821657736338717ULL) >> 11) / 9007199254740992.0;
+}
+
+// -----------------------------
+// Carregador sintético: "caso-<n>" tem entre 8 e 64 salas, cada uma com pista.
+// Não lê arquivos, para que o tempo medido seja o do cache e da montagem.
+// -----------------------------
+static Caso *carregadorSintetico(void *contexto, const char *nome, size_t *bytes) {
+    unsigned numCasos = *(const unsigned*) contexto;
+    unsigned id;
+    if (sscanf(nome, "caso-%u", &id) != 1 || id >= numCasos) return NULL;
+
+    CasoConstrutor b;
+    construtorInicializa(&b);
+    unsigned numSalas = 8 + (id * 2654435761u) % 57;
+    char sid[32], snome[64], pista[128], suspeito[32];
+    for (unsigned i = 0; i < numSalas; ++i) {
+        snprintf(sid, sizeof(sid), "s%u", i);
+        snprintf(snome, sizeof(snome), "Sala %u do caso %u", i, id);
+        snprintf(pista, sizeof(pista), "Pista %u deixada no caso %u perto da sala %u", i, id, i);
+        snprintf(suspeito, sizeof(suspeito), "Suspeito %c", 'A' + (int)(i % 6));
+        construtorAdicionarSala(&b, sid, snome, pista);
+        construtorAssociar(&b, pista, suspeito);
+        if (i > 0) {   // árvore binária completa por índices
+            CasoSala *pai = &b.salas[(i - 1) / 2];
+            if (i % 2) pai->esquerda = i; else pai->direita = i;
+        }
+    }
+    Caso *caso = NULL;
+    if (construtorGerarHashPerfeita(&b) == 0) caso = construtorEmpacotar(&b, bytes);
+    construtorLiberar(&b);
+    return caso;
+}
+
+// sorteia índice em [0, n) pela distribuição acumulada (busca binária)
+static unsigned sorteiaZipf(const double *acumulada, unsigned n) {
+    double u = aleatorio();
+    unsigned lo = 0, hi = n - 1;
+    while (lo < hi) {
+        unsigned mid = lo + (hi - lo) / 2;
+        if (acumulada[mid] < u) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv) {
+    unsigned numCasos = argc > 1 ? (unsigned) atoi(argv[1]) : 5000;
+    unsigned long numAcessos = argc > 2 ? strtoul(argv[2], NULL, 10) : 500000;
+    double s = argc > 3 ? atof(argv[3]) : 1.0;
+    if (numCasos == 0 || numAcessos == 0) {
+        fprintf(stderr, "Uso: %s [numCasos] [numAcessos] [expoenteZipf]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // distribuição acumulada de Zipf: P(k) ~ 1 / k^s
+    double *acumulada = (double*) malloc(numCasos * sizeof(double));
+    if (!acumulada) {
+        fprintf(stderr, "Erro: sem memória.\n");
+        return EXIT_FAILURE;
+    }
+    double soma = 0.0;
+    for (unsigned k = 0; k < numCasos; ++k) soma += 1.0 / pow(k + 1.0, s);
+    double parcial = 0.0;
+    for (unsigned k = 0; k < numCasos; ++k) {
+        parcial += 1.0 / pow(k + 1.0, s) / soma;
+        acumulada[k] = parcial;
+    }
+    acumulada[numCasos - 1] = 1.0;
+
+    // tamanho total do catálogo (para expressar o orçamento em %)
+    size_t total = 0;
+    for (unsigned k = 0; k < numCasos; ++k) {
+        char nome[32];
+        size_t bytes = 0;
+        snprintf(nome, sizeof(nome), "caso-%u", k);
+        free(carregadorSintetico(&numCasos, nome, &bytes));
+        total += bytes + sizeof(CatalogoCaso) + strlen(nome) + 1;
+    }
+
+    printf("%u casos (%.1f MiB no total), %lu acessos, Zipf s=%.2f, %d sessões ativas\n\n",
+           numCasos, total / 1048576.0, numAcessos, s, SESSOES_ATIVAS);
+    printf("%9s %12s %12s %12s %10s %10s %12s\n",
+           "orçamento", "acertos", "faltas", "despejos", "taxa", "ns/acesso", "pico MiB");
+
+    const double fracoes[] = { 0.01, 0.05, 0.10, 0.25, 0.50, 1.00 };
+    for (size_t f = 0; f < sizeof(fracoes) / sizeof(fracoes[0]); ++f) {
+        Catalogo cat;
+        catalogoInicializar(&cat, (size_t)(total * fracoes[f]), carregadorSintetico, &numCasos);
+        CatalogoCaso *sessoes[SESSOES_ATIVAS] = { 0 };
+        size_t pico = 0;
+        unsigned long checagem = 0;
+        estado = 88172645463325252ULL;
+
+        double t0 = agora();
+        for (unsigned long i = 0; i < numAcessos; ++i) {
+            char nome[32];
+            snprintf(nome, sizeof(nome), "caso-%u", sorteiaZipf(acumulada, numCasos));
+            unsigned slot = (unsigned)(i % SESSOES_ATIVAS);
+            catalogoFechar(&cat, sessoes[slot]);
+            sessoes[slot] = catalogoAbrir(&cat, nome);
+            checagem += sessoes[slot]->caso->numSalas;   // usa o caso de fato
+            if (cat.bytesEmUso > pico) pico = cat.bytesEmUso;
+        }
+        double t1 = agora();
+
+        const CatalogoMetricas *m = &cat.metricas;
+        printf("%8.0f%% %12lu %12lu %12lu %9.2f%% %10.0f %12.2f\n",
+               fracoes[f] * 100, m->acertos, m->faltas, m->despejos,
+               100.0 * m->acertos / numAcessos, (t1 - t0) * 1e9 / numAcessos, pico / 1048576.0);
+        if (checagem == 0) printf("(checagem nula)\n");
+
+        for (unsigned k = 0; k < SESSOES_ATIVAS; ++k) catalogoFechar(&cat, sessoes[k]);
+        catalogoLiberar(&cat);
+    }
+
+    free(acumulada);
+    return 0;
+}
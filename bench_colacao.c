@@ -0,0 +1,153 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <locale.h>
+#include <time.h>
+#include "colacao.h"
+
+// -----------------------------
+// bench_colacao.c
+// Compara o custo de inserir pistas em uma BST ordenando por:
+//   - strcmp (ordem dos bytes, como era antes)
+//   - strcoll (ordem do locale, recalculada a cada comparação)
+//   - chave de colação (colacao.h) calculada uma vez + memcmp
+// e mostra a ordem obtida para algumas pistas acentuadas.
+//
+// Uso: bench_colacao [numPistas]     (padrão: 200000)
+//   compilar: gcc -O2 bench_colacao.c -o bench_colacao
+// strcoll usa pt_BR.UTF-8 se estiver instalado; senão, o locale do ambiente.
+// -----------------------------
+
+typedef struct No {
+    const char *pista;
+    unsigned char *chave;
+    size_t tamChave;
+    struct No *esq, *dir;
+} No;
+
+static const char *palavras[] = {
+    "Porão", "Porta", "porta", "Sótão", "sótão", "família", "familiar", "Família",
+    "Ética", "estante", "Escritório", "escada", "Árvore", "arbusto", "Cozinha", "coração",
+    "maçã", "maca", "Maçaneta", "lâmpada", "lampião", "Óculos", "ocre", "último", "umbral"
+};
+#define NUM(v) (sizeof(v) / sizeof((v)[0]))
+
+static unsigned long long estado = 88172645463325252ULL;
+static unsigned long long aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 2685821657736338717ULL;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// nó com espaço para a chave logo em seguida (mesma alocação, como o PistaNode de motor_jogo.h)
+static No *novoNo(const char *pista, const unsigned char *chave, size_t tamChave) {
+    No *n = (No*) calloc(1, sizeof(No) + tamChave);
+    if (!n) {
+        fprintf(stderr, "Erro: sem memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    n->pista = pista;
+    if (chave) {
+        n->chave = (unsigned char*)(n + 1);
+        n->tamChave = tamChave;
+        memcpy(n->chave, chave, tamChave);
+    }
+    return n;
+}
+
+// modo: 0 = strcmp, 1 = strcoll, 2 = chave de colação
+static No *inserir(No *raiz, const char *pista, int modo) {
+    unsigned char local[COLACAO_MAX_PILHA];
+    unsigned char *chave = NULL;
+    size_t tamChave = 0;
+    if (modo == 2) {
+        chave = colacaoChaveEm(pista, local, sizeof(local), &tamChave);
+    }
+
+    No **pos = &raiz;
+    int cmp = 1;
+    while (*pos && cmp != 0) {
+        if (modo == 0) cmp = strcmp(pista, (*pos)->pista);
+        else if (modo == 1) cmp = strcoll(pista, (*pos)->pista);
+        else cmp = colacaoCompara(chave, tamChave, (*pos)->chave, (*pos)->tamChave);
+        if (cmp != 0) pos = cmp < 0 ? &(*pos)->esq : &(*pos)->dir;
+    }
+    if (cmp != 0) *pos = novoNo(pista, chave, tamChave);
+    if (chave != local) free(chave);
+    return raiz;
+}
+
+static void imprimirEmOrdem(const No *n) {
+    if (!n) return;
+    imprimirEmOrdem(n->esq);
+    printf(" %s", n->pista);
+    imprimirEmOrdem(n->dir);
+}
+
+static void liberar(No *n) {
+    if (!n) return;
+    liberar(n->esq);
+    liberar(n->dir);
+    free(n);
+}
+
+int main(int argc, char **argv) {
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+    if (n == 0) {
+        fprintf(stderr, "Uso: %s [numPistas]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char *loc = setlocale(LC_COLLATE, "pt_BR.UTF-8");
+    if (!loc) loc = setlocale(LC_COLLATE, "");
+    printf("locale de strcoll: %s\n\n", loc ? loc : "C");
+
+    const char *nomes[] = { "strcmp", "strcoll", "chave+memcmp" };
+
+    // ordem obtida para as palavras de exemplo
+    for (int modo = 0; modo < 3; ++modo) {
+        No *raiz = NULL;
+        for (size_t i = 0; i < NUM(palavras); ++i) raiz = inserir(raiz, palavras[i], modo);
+        printf("%-13s:", nomes[modo]);
+        imprimirEmOrdem(raiz);
+        printf("\n");
+        liberar(raiz);
+    }
+
+    // pistas sintéticas: três palavras acentuadas + número
+    char **pistas = (char**) malloc(n * sizeof(char*));
+    char buffer[256];
+    for (size_t i = 0; i < n; ++i) {
+        unsigned long long r = aleatorio();
+        snprintf(buffer, sizeof(buffer), "%s %s %s %zu", palavras[r % NUM(palavras)],
+                 palavras[(r >> 8) % NUM(palavras)], palavras[(r >> 16) % NUM(palavras)], i);
+        size_t tam = strlen(buffer) + 1;
+        pistas[i] = (char*) malloc(tam);
+        memcpy(pistas[i], buffer, tam);
+    }
+
+    printf("\n%zu inserções na BST\n", n);
+    printf("%-13s %12s %10s\n", "ordem", "ns/inserção", "relativo");
+    double base = 0.0;
+    for (int modo = 0; modo < 3; ++modo) {
+        double t0 = agora();
+        No *raiz = NULL;
+        for (size_t i = 0; i < n; ++i) raiz = inserir(raiz, pistas[i], modo);
+        double t = (agora() - t0) * 1e9 / n;
+        if (modo == 0) base = t;
+        printf("%-13s %12.1f %9.2fx\n", nomes[modo], t, t / base);
+        liberar(raiz);
+    }
+
+    for (size_t i = 0; i < n; ++i) free(pistas[i]);
+    free(pistas);
+    return 0;
+}
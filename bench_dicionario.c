@@ -0,0 +1,289 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#include "dicionario_pistas.h"
+
+// -----------------------------
+// bench_dicionario.c
+// Compara memória e tempo do dicionário compactado (dicionario_pistas.h)
+// com a representação atual das pistas: BST de PistaNode com cada texto
+// em uma string alocada separadamente.
+//
+// Uso: bench_dicionario [numPistas]      (padrão: 1000000)
+//   compilar: gcc -O2 bench_dicionario.c -o bench_dicionario
+// -----------------------------
+
+// mesmo nó usado nos programas dos níveis
+typedef struct PistaNode {
+    char *pista;
+    struct PistaNode *esq;
+    struct PistaNode *dir;
+} PistaNode;
+
+static const char *objetos[] = {
+    "Bilhete rasgado", "Pegadas molhadas", "Faca com monograma", "Livro aberto",
+    "Foto antiga da família", "Raspas de tinta", "Carta com assinatura parcial",
+    "Chave enferrujada", "Luva de couro", "Taça quebrada", "Relógio parado", "Lenço bordado"
+};
+static const char *locais[] = {
+    "perto da lareira", "sob o tapete", "atrás da estante", "no parapeito da janela",
+    "dentro da gaveta", "junto à escada", "ao lado do piano", "no fundo do armário"
+};
+static const char *detalhes[] = {
+    "com hora marcada", "com iniciais gravadas", "com manchas escuras",
+    "com cheiro de perfume", "com marcas de unhas", "com poeira recente"
+};
+
+#define NUM(v) (sizeof(v) / sizeof((v)[0]))
+
+static unsigned long long estado = 88172645463325252ULL;
+static unsigned long long aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 2685821657736338717ULL;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// bytes em uso no heap (glibc); 0 se não houver como medir
+static size_t heapEmUso(void) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+static int comparaStrings(const void *a, const void *b) {
+    return strcmp(*(const char *const *) a, *(const char *const *) b);
+}
+
+// -----------------------------
+// BST de referência (iterativa para não depender da altura)
+// -----------------------------
+static PistaNode *inserirBST(PistaNode *raiz, const char *pista) {
+    PistaNode **p = &raiz;
+    while (*p) {
+        int cmp = strcmp(pista, (*p)->pista);
+        if (cmp == 0) return raiz;
+        p = cmp < 0 ? &(*p)->esq : &(*p)->dir;
+    }
+    PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode));
+    size_t tam = strlen(pista) + 1;
+    char *copia = (char*) malloc(tam);
+    if (!n || !copia) {
+        fprintf(stderr, "Erro: sem memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(copia, pista, tam);
+    n->pista = copia;
+    n->esq = n->dir = NULL;
+    *p = n;
+    return raiz;
+}
+
+static int buscarBST(const PistaNode *raiz, const char *pista) {
+    while (raiz) {
+        int cmp = strcmp(pista, raiz->pista);
+        if (cmp == 0) return 1;
+        raiz = cmp < 0 ? raiz->esq : raiz->dir;
+    }
+    return 0;
+}
+
+// percurso em ordem com pilha explícita (soma dos tamanhos, para não otimizar fora)
+static size_t percorrerBST(PistaNode *raiz, size_t numNos) {
+    PistaNode **pilha = (PistaNode**) malloc((numNos + 1) * sizeof(PistaNode*));
+    size_t topo = 0, soma = 0;
+    PistaNode *n = raiz;
+    while (n || topo) {
+        while (n) { pilha[topo++] = n; n = n->esq; }
+        n = pilha[--topo];
+        soma += strlen(n->pista);
+        n = n->dir;
+    }
+    free(pilha);
+    return soma;
+}
+
+// listagem em ordem da BST em um vetor (para conferir elemento a elemento)
+static size_t listarBST(PistaNode *raiz, const char **saida, size_t numNos) {
+    PistaNode **pilha = (PistaNode**) malloc((numNos + 1) * sizeof(PistaNode*));
+    size_t topo = 0, k = 0;
+    PistaNode *n = raiz;
+    while (n || topo) {
+        while (n) { pilha[topo++] = n; n = n->esq; }
+        n = pilha[--topo];
+        saida[k++] = n->pista;
+        n = n->dir;
+    }
+    free(pilha);
+    return k;
+}
+
+static void liberarBST(PistaNode *raiz, size_t numNos) {
+    PistaNode **pilha = (PistaNode**) malloc((numNos + 1) * sizeof(PistaNode*));
+    size_t topo = 0;
+    if (raiz) pilha[topo++] = raiz;
+    while (topo) {
+        PistaNode *n = pilha[--topo];
+        if (n->esq) pilha[topo++] = n->esq;
+        if (n->dir) pilha[topo++] = n->dir;
+        free(n->pista);
+        free(n);
+    }
+    free(pilha);
+}
+
+static void somaTamanho(const char *pista, void *contexto) {
+    *(size_t*) contexto += strlen(pista);
+}
+
+// conferência da listagem do dicionário contra a da BST
+typedef struct Conferencia {
+    const char **esperadas;
+    size_t num, pos, divergencias;
+} Conferencia;
+
+static void confereListagem(const char *pista, void *contexto) {
+    Conferencia *c = (Conferencia*) contexto;
+    if (c->pos >= c->num || strcmp(pista, c->esperadas[c->pos]) != 0) {
+        if (c->divergencias++ == 0)
+            fprintf(stderr, "Erro: posição %zu: \"%s\" x \"%s\"\n", c->pos, pista,
+                    c->pos < c->num ? c->esperadas[c->pos] : "(fim da BST)");
+    }
+    c->pos++;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    if (n == 0) {
+        fprintf(stderr, "Uso: %s [numPistas]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // pistas sintéticas: frases longas e parecidas, como nos casos reais
+    char **pistas = (char**) malloc(n * sizeof(char*));
+    char buffer[256];
+    size_t textoBruto = 0;
+    for (size_t i = 0; i < n; ++i) {
+        unsigned long long r = aleatorio();
+        snprintf(buffer, sizeof(buffer), "%s %s %s, caso %07zu",
+                 objetos[r % NUM(objetos)], locais[(r >> 8) % NUM(locais)],
+                 detalhes[(r >> 16) % NUM(detalhes)], i);
+        size_t tam = strlen(buffer) + 1;
+        pistas[i] = (char*) malloc(tam);
+        memcpy(pistas[i], buffer, tam);
+        textoBruto += tam;
+    }
+
+    // BST: inserção em ordem embaralhada (na ordem de geração, pistas com o
+    // mesmo início chegariam crescentes e a árvore degeneraria em listas)
+    size_t *ordem = (size_t*) malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; ++i) ordem[i] = i;
+    for (size_t i = n - 1; i > 0; --i) {
+        size_t j = aleatorio() % (i + 1), t = ordem[i];
+        ordem[i] = ordem[j];
+        ordem[j] = t;
+    }
+    size_t antes = heapEmUso();
+    double t0 = agora();
+    PistaNode *raiz = NULL;
+    for (size_t i = 0; i < n; ++i) raiz = inserirBST(raiz, pistas[ordem[i]]);
+    double tMontaBST = agora() - t0;
+    size_t memBST = heapEmUso() - antes;
+    if (memBST == 0) memBST = n * sizeof(PistaNode) + textoBruto;   // estimativa sem mallinfo2
+    free(ordem);
+
+    // dicionário: exige entrada ordenada
+    t0 = agora();
+    char **ordenadas = (char**) malloc(n * sizeof(char*));
+    memcpy(ordenadas, pistas, n * sizeof(char*));
+    qsort(ordenadas, n, sizeof(char*), comparaStrings);
+    DicionarioPistas dic;
+    dicionarioInicializar(&dic);
+    for (size_t i = 0; i < n; ++i) dicionarioAcrescentar(&dic, ordenadas[i]);
+    dicionarioFinalizar(&dic);
+    double tMontaDic = agora() - t0;
+    free(ordenadas);
+    size_t memDic = dicionarioBytes(&dic);
+
+    printf("%zu pistas, %.1f MiB de texto bruto\n\n", n, textoBruto / 1048576.0);
+    printf("%-24s %12s %12s %14s\n", "representação", "MiB", "bytes/pista", "montagem (s)");
+    printf("%-24s %12.1f %12.1f %14.3f\n", "BST + strings (atual)", memBST / 1048576.0, (double) memBST / n, tMontaBST);
+    printf("%-24s %12.1f %12.1f %14.3f\n", "front coding", memDic / 1048576.0, (double) memDic / n, tMontaDic);
+    printf("redução: %.1fx\n\n", (double) memBST / memDic);
+
+    // listagem ordenada
+    t0 = agora();
+    size_t somaBST = percorrerBST(raiz, n);
+    double tListaBST = agora() - t0;
+    size_t somaDic = 0;
+    t0 = agora();
+    dicionarioPercorrer(&dic, somaTamanho, &somaDic);
+    double tListaDic = agora() - t0;
+
+    // buscas: metade existentes, metade ausentes
+    size_t consultas = n < 1000000 ? n : 1000000;
+    size_t achadosBST = 0, achadosDic = 0;
+    estado = 88172645463325252ULL;
+    t0 = agora();
+    for (size_t i = 0; i < consultas; ++i) {
+        const char *p = pistas[aleatorio() % n];
+        if (i % 2) achadosBST += buscarBST(raiz, p);
+        else {
+            snprintf(buffer, sizeof(buffer), "%sX", p);
+            achadosBST += buscarBST(raiz, buffer);
+        }
+    }
+    double tBuscaBST = agora() - t0;
+    estado = 88172645463325252ULL;
+    t0 = agora();
+    for (size_t i = 0; i < consultas; ++i) {
+        const char *p = pistas[aleatorio() % n];
+        if (i % 2) achadosDic += dicionarioBuscar(&dic, p) >= 0;
+        else {
+            snprintf(buffer, sizeof(buffer), "%sX", p);
+            achadosDic += dicionarioBuscar(&dic, buffer) >= 0;
+        }
+    }
+    double tBuscaDic = agora() - t0;
+
+    printf("%-24s %14s %14s\n", "operação", "BST (ns)", "front (ns)");
+    printf("%-24s %14.1f %14.1f\n", "listagem (por pista)", tListaBST * 1e9 / n, tListaDic * 1e9 / n);
+    printf("%-24s %14.1f %14.1f\n", "busca exata", tBuscaBST * 1e9 / consultas, tBuscaDic * 1e9 / consultas);
+
+    // conferência: as duas listagens, elemento a elemento, e as buscas
+    const char **listaBST = (const char**) malloc(n * sizeof(char*));
+    Conferencia conf = { listaBST, listarBST(raiz, listaBST, n), 0, 0 };
+    dicionarioPercorrer(&dic, confereListagem, &conf);
+    free(listaBST);
+    if (conf.divergencias || conf.pos != conf.num || conf.num != n || somaBST != somaDic || dic.numPistas != n) {
+        fprintf(stderr, "Erro: listagens divergem (%zu divergências; %zu x %zu pistas).\n",
+                conf.divergencias, conf.pos, conf.num);
+        return EXIT_FAILURE;
+    }
+    if (achadosBST != achadosDic || achadosBST != consultas / 2) {
+        fprintf(stderr, "Erro: buscas divergem (%zu x %zu; esperado %zu).\n", achadosBST, achadosDic, consultas / 2);
+        return EXIT_FAILURE;
+    }
+    printf("\nconferência: %zu/%zu encontradas (BST), %zu/%zu (front coding)\n",
+           achadosBST, consultas, achadosDic, consultas);
+
+    liberarBST(raiz, n);
+    dicionarioLiberar(&dic);
+    for (size_t i = 0; i < n; ++i) free(pistas[i]);
+    free(pistas);
+    return 0;
+}
@@ -0,0 +1,664 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// -----------------------------
+// bench_motor.c
+// Compara cada nível montado sobre o motor comum (motor_jogo.h) com a sua
+// versão avulsa anterior (cópia do código que cada nível tinha antes do
+// motor). Cada sessão monta o mapa, faz uma exploração roteirizada,
+// percorre as pistas coletadas e libera tudo. A saída do jogo é desligada
+// (MOTOR_TELA) nas duas versões, para medir só o caminho quente.
+// No Mestre a versão avulsa é o "Nivel Mestre.c" de 9a4260b inteiro
+// (bench_motor_mestre_avulso.c): as duas versões jogam a partida completa,
+// com acusação e veredito, repetindo as mesmas trilhas em memória.
+//
+// Um nível por compilação (os recursos do motor são escolhidos em tempo de
+// compilação): NIVEL 1 = Novato, 2 = Aventureiro, 3 = Mestre.
+// Uso: bench_motor [numSessoes]    (padrão: 200000)
+//   compilar: gcc -O2 -DNIVEL=1 bench_motor.c -o bench_motor_novato
+//             gcc -O2 -DNIVEL=3 bench_motor.c bench_motor_mestre_avulso.c -o bench_motor_mestre
+// -----------------------------
+
+#ifndef NIVEL
+#define NIVEL 3
+#endif
+
+#define NUM_ROTEIROS 1024
+#define PROFUNDIDADE_GRANDE 10             // mapa grande: 2^10 - 1 salas
+
+// entrada roteirizada (as duas versões leem as mesmas teclas)
+typedef struct Roteiro {
+    const char *teclas;
+    size_t pos;
+} Roteiro;
+
+static int leRoteiro(void *contexto, char *opc) {
+    Roteiro *r = (Roteiro*) contexto;
+    *opc = r->teclas[r->pos] ? r->teclas[r->pos++] : 's';
+    return 1;
+}
+
+#define MOTOR_TELA(...) ((void) 0)
+#define TELA(...) ((void) 0)
+
+#if NIVEL == 3
+// no Mestre as escolhas e as pistas passam pela partida (gravação ou repetição de trilha)
+#include "trilha_sessao.h"
+struct Partida;
+static int partidaEscolha(struct Partida *p, char *opc);
+static void partidaPista(struct Partida *p, uint32_t sala);
+#define MOTOR_LER_ESCOLHA(contexto, opc) partidaEscolha((struct Partida*) (contexto), (opc))
+#define MOTOR_PISTA_COLETADA(contexto, sala) partidaPista((struct Partida*) (contexto), (sala))
+#else
+#define MOTOR_LER_ESCOLHA(contexto, opc) leRoteiro((contexto), (opc))
+#endif
+
+#if NIVEL == 1
+#define MOTOR_PISTAS 0
+#define MOTOR_SUSPEITOS 0
+#define MOTOR_VEREDITO 0
+#elif NIVEL == 2
+#define MOTOR_PISTAS 1
+#define MOTOR_SUSPEITOS 0
+#define MOTOR_VEREDITO 0
+#define ORDEM_COLACAO 0
+#endif
+#include "motor_jogo.h"
+#include "percurso_arvore.h"
+#if NIVEL == 3
+#include "caso_mansao.h"
+#include "caso_construtor.h"
+#endif
+
+static unsigned long long estado = 88172645463325252ULL;
+static unsigned long long aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 2685821657736338717ULL;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *aloca(size_t n) {
+    void *p = malloc(n);
+    if (!p) {
+        fprintf(stderr, "Erro: sem memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+// salas dos mapas de cada nível (filhos por índice; -1 = sem saída)
+typedef struct DescricaoSala {
+    const char *nome, *pista;
+    int esquerda, direita;
+} DescricaoSala;
+
+#if NIVEL == 1
+static const DescricaoSala MAPA_NIVEL[] = {
+    { "Hall de Entrada", NULL, 1, 2 }, { "Sala de Estar", NULL, 3, 4 }, { "Cozinha", NULL, 5, 6 },
+    { "Biblioteca", NULL, -1, -1 }, { "Jardim", NULL, -1, -1 }, { "Porão", NULL, -1, -1 },
+    { "Escritório", NULL, -1, -1 }
+};
+#elif NIVEL == 2
+static const DescricaoSala MAPA_NIVEL[] = {
+    { "Hall de Entrada", "Bilhete rasgado com a hora marcada", 1, 2 },
+    { "Sala de Estar", "Pegadas molhadas perto da lareira", 3, 4 },
+    { "Cozinha", "Faca com monograma X", 5, 6 },
+    { "Biblioteca", "Livro apontando para passagem secreta", 7, -1 },
+    { "Jardim", "Foto antiga da família no arbusto", -1, -1 },
+    { "Porão", "Raspas de tinta da mesma cor da mansão", -1, -1 },
+    { "Escritório", "Carta com uma assinatura parcial", -1, -1 },
+    { "Sótão", "Caixa trancada com três chaves faltando", -1, -1 }
+};
+#endif
+
+// mapa descrito: do nível ou árvore completa com 'numGrande' salas (pistas com repetição)
+static DescricaoSala *mapaGrande;
+static size_t numGrande;
+
+static void montaMapaGrande(void) {
+    numGrande = (1u << PROFUNDIDADE_GRANDE) - 1;
+    mapaGrande = (DescricaoSala*) aloca(numGrande * sizeof(DescricaoSala));
+    for (size_t i = 0; i < numGrande; ++i) {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "Sala %zu do corredor leste", i);
+        mapaGrande[i].nome = strcpy((char*) aloca(strlen(buffer) + 1), buffer);
+        snprintf(buffer, sizeof(buffer), "Pista %zu encontrada no chão", i % (numGrande / 4));
+        mapaGrande[i].pista = strcpy((char*) aloca(strlen(buffer) + 1), buffer);
+        mapaGrande[i].esquerda = 2 * i + 1 < numGrande ? (int)(2 * i + 1) : -1;
+        mapaGrande[i].direita = 2 * i + 2 < numGrande ? (int)(2 * i + 2) : -1;
+    }
+}
+
+// roteiros: sequências aleatórias de 'e'/'d' (às vezes inválidas) terminadas em 's'
+static char roteiros[NUM_ROTEIROS][PROFUNDIDADE_GRANDE + 4];
+
+static void montaRoteiros(void) {
+    for (int r = 0; r < NUM_ROTEIROS; ++r) {
+        int n = 0;
+        while (n < PROFUNDIDADE_GRANDE + 1) roteiros[r][n++] = (aleatorio() % 8 == 0) ? 'x' : (aleatorio() % 2 ? 'e' : 'd');
+        roteiros[r][n++] = 's';
+        roteiros[r][n] = '\0';
+    }
+}
+
+// =============================
+// Versões avulsas (código de cada nível antes do motor comum)
+// =============================
+#if NIVEL == 1
+typedef struct SalaAvulsa {
+    char nome[50];
+    struct SalaAvulsa *esquerda;
+    struct SalaAvulsa *direita;
+} SalaAvulsa;
+
+static SalaAvulsa *criarSalaAvulsa(const char *nome) {
+    SalaAvulsa *novaSala = (SalaAvulsa*) aloca(sizeof(SalaAvulsa));
+    strncpy(novaSala->nome, nome, sizeof(novaSala->nome) - 1);
+    novaSala->nome[sizeof(novaSala->nome) - 1] = '\0';
+    novaSala->esquerda = NULL;
+    novaSala->direita = NULL;
+    return novaSala;
+}
+
+static void explorarAvulso(SalaAvulsa *salaAtual, Roteiro *r) {
+    char escolha;
+    while (salaAtual != NULL) {
+        TELA("\nVocê está na: %s\n", salaAtual->nome);
+        if (salaAtual->esquerda == NULL && salaAtual->direita == NULL) {
+            TELA("Você chegou ao fim do caminho!\n");
+            break;
+        }
+        TELA("Escolha o caminho:\n");
+        if (salaAtual->esquerda != NULL) TELA(" (e) Ir para %s à esquerda\n", salaAtual->esquerda->nome);
+        if (salaAtual->direita != NULL) TELA(" (d) Ir para %s à direita\n", salaAtual->direita->nome);
+        TELA(" (s) Sair do jogo\n");
+        TELA("Digite sua opção: ");
+        leRoteiro(r, &escolha);
+        if (escolha == 'e' || escolha == 'E') {
+            if (salaAtual->esquerda != NULL) salaAtual = salaAtual->esquerda;
+            else TELA("Não há caminho à esquerda!\n");
+        } else if (escolha == 'd' || escolha == 'D') {
+            if (salaAtual->direita != NULL) salaAtual = salaAtual->direita;
+            else TELA("Não há caminho à direita!\n");
+        } else if (escolha == 's' || escolha == 'S') {
+            TELA("Você decidiu encerrar a exploração.\n");
+            break;
+        } else {
+            TELA("Opção inválida! Tente novamente.\n");
+        }
+    }
+}
+
+static size_t sessaoAvulsa(const DescricaoSala *d, size_t n, Roteiro *r) {
+    SalaAvulsa **salas = (SalaAvulsa**) aloca(n * sizeof(SalaAvulsa*));
+    for (size_t i = 0; i < n; ++i) salas[i] = criarSalaAvulsa(d[i].nome);
+    for (size_t i = 0; i < n; ++i) {
+        salas[i]->esquerda = d[i].esquerda >= 0 ? salas[d[i].esquerda] : NULL;
+        salas[i]->direita = d[i].direita >= 0 ? salas[d[i].direita] : NULL;
+    }
+    SalaAvulsa *raiz = salas[0];
+    free(salas);
+    explorarAvulso(raiz, r);
+    arvoreLiberar(raiz, ARVORE_FILHOS(SalaAvulsa, esquerda, direita), NULL, NULL);
+    return r->pos;   // teclas lidas antes de chegar a uma folha ou sair
+}
+
+static size_t sessaoMotor(const DescricaoSala *d, size_t n, Roteiro *r) {
+    Mapa mapa;
+    mapaInicializar(&mapa);
+    for (size_t i = 0; i < n; ++i) criarSala(&mapa, d[i].nome);
+    for (size_t i = 0; i < n; ++i) {
+        ligarSalas(&mapa, (uint32_t) i, d[i].esquerda >= 0 ? (uint32_t) d[i].esquerda : SALA_NENHUMA,
+                   d[i].direita >= 0 ? (uint32_t) d[i].direita : SALA_NENHUMA);
+    }
+    Jogo jogo = { &mapa };
+    explorarSalas(&jogo, r);
+    liberarSalas(&mapa);
+    return r->pos;   // teclas lidas
+}
+
+#elif NIVEL == 2
+typedef struct SalaAvulsa {
+    char nome[60];
+    char *pista;
+    struct SalaAvulsa *esquerda;
+    struct SalaAvulsa *direita;
+} SalaAvulsa;
+
+typedef struct PistaAvulsa {
+    char *pista;
+    struct PistaAvulsa *esq;
+    struct PistaAvulsa *dir;
+} PistaAvulsa;
+
+static char *copiarString(const char *s) {
+    if (s == NULL) return NULL;
+    size_t n = strlen(s) + 1;
+    return (char*) memcpy(aloca(n), s, n);
+}
+
+static SalaAvulsa *criarSalaAvulsa(const char *nome, const char *pista) {
+    SalaAvulsa *nova = (SalaAvulsa*) aloca(sizeof(SalaAvulsa));
+    strncpy(nova->nome, nome, sizeof(nova->nome) - 1);
+    nova->nome[sizeof(nova->nome) - 1] = '\0';
+    nova->pista = (pista != NULL && strlen(pista) > 0) ? copiarString(pista) : NULL;
+    nova->esquerda = nova->direita = NULL;
+    return nova;
+}
+
+static PistaAvulsa *inserirPistaAvulsa(PistaAvulsa *raiz, const char *pista) {
+    PistaAvulsa **pos = &raiz;
+    while (*pos != NULL) {
+        int cmp = strcmp(pista, (*pos)->pista);
+        if (cmp == 0) return raiz;
+        pos = cmp < 0 ? &(*pos)->esq : &(*pos)->dir;
+    }
+    PistaAvulsa *n = (PistaAvulsa*) aloca(sizeof(PistaAvulsa));
+    n->pista = copiarString(pista);
+    n->esq = n->dir = NULL;
+    *pos = n;
+    return raiz;
+}
+
+static void liberarNoPista(void *no, void *contexto) {
+    (void) contexto;
+    free(((PistaAvulsa*) no)->pista);
+    free(no);
+}
+
+static void liberarNoSala(void *no, void *contexto) {
+    (void) contexto;
+    SalaAvulsa *sala = (SalaAvulsa*) no;
+    if (sala->pista) free(sala->pista);
+    free(sala);
+}
+
+static void contaPista(void *no, void *contexto) {
+    (void) no;
+    (*(size_t*) contexto)++;
+}
+
+static void explorarAvulso(SalaAvulsa *atual, PistaAvulsa **arvorePistas, Roteiro *r) {
+    char opcao;
+    while (atual != NULL) {
+        TELA("\nVocê está em: %s\n", atual->nome);
+        if (atual->pista != NULL) {
+            TELA("Você encontrou uma pista: \"%s\"\n", atual->pista);
+            *arvorePistas = inserirPistaAvulsa(*arvorePistas, atual->pista);
+            free(atual->pista);
+            atual->pista = NULL;
+        } else {
+            TELA("Nenhuma pista nova aqui.\n");
+        }
+        TELA("\nOpções:\n");
+        if (atual->esquerda) TELA(" (e) Ir para %s (esquerda)\n", atual->esquerda->nome);
+        if (atual->direita) TELA(" (d) Ir para %s (direita)\n", atual->direita->nome);
+        TELA(" (s) Sair da exploração e ver pistas coletadas\n");
+        TELA("Escolha: ");
+        leRoteiro(r, &opcao);
+        if (opcao == 'e' || opcao == 'E') {
+            if (atual->esquerda) atual = atual->esquerda;
+            else TELA("Não há caminho à esquerda. Escolha outra opção.\n");
+        } else if (opcao == 'd' || opcao == 'D') {
+            if (atual->direita) atual = atual->direita;
+            else TELA("Não há caminho à direita. Escolha outra opção.\n");
+        } else if (opcao == 's' || opcao == 'S') {
+            TELA("Encerrando exploração por opção do jogador.\n");
+            break;
+        } else {
+            TELA("Opção inválida. Use 'e', 'd' ou 's'.\n");
+        }
+    }
+}
+
+static size_t sessaoAvulsa(const DescricaoSala *d, size_t n, Roteiro *r) {
+    SalaAvulsa **salas = (SalaAvulsa**) aloca(n * sizeof(SalaAvulsa*));
+    for (size_t i = 0; i < n; ++i) salas[i] = criarSalaAvulsa(d[i].nome, d[i].pista);
+    for (size_t i = 0; i < n; ++i) {
+        salas[i]->esquerda = d[i].esquerda >= 0 ? salas[d[i].esquerda] : NULL;
+        salas[i]->direita = d[i].direita >= 0 ? salas[d[i].direita] : NULL;
+    }
+    SalaAvulsa *raiz = salas[0];
+    free(salas);
+    PistaAvulsa *pistas = NULL;
+    explorarAvulso(raiz, &pistas, r);
+    size_t coletadas = 0;
+    arvoreEmOrdem(pistas, ARVORE_FILHOS(PistaAvulsa, esq, dir), contaPista, &coletadas);
+    arvoreLiberar(pistas, ARVORE_FILHOS(PistaAvulsa, esq, dir), liberarNoPista, NULL);
+    arvoreLiberar(raiz, ARVORE_FILHOS(SalaAvulsa, esquerda, direita), liberarNoSala, NULL);
+    return coletadas;
+}
+
+static size_t sessaoMotor(const DescricaoSala *d, size_t n, Roteiro *r) {
+    Mapa mapa;
+    mapaInicializar(&mapa);
+    for (size_t i = 0; i < n; ++i) criarSala(&mapa, d[i].nome, d[i].pista);
+    for (size_t i = 0; i < n; ++i) {
+        ligarSalas(&mapa, (uint32_t) i, d[i].esquerda >= 0 ? (uint32_t) d[i].esquerda : SALA_NENHUMA,
+                   d[i].direita >= 0 ? (uint32_t) d[i].direita : SALA_NENHUMA);
+    }
+    Jogo jogo = { &mapa, NULL };
+    explorarSalas(&jogo, r);
+    size_t coletadas = 0;
+    arvoreEmOrdem(jogo.pistas, ARVORE_FILHOS(PistaNode, esq, dir), contaPista, &coletadas);
+    liberarPistas(jogo.pistas);
+    liberarSalas(&mapa);
+    return coletadas;
+}
+
+#else
+// -----------------------------
+// Mestre: as duas versões jogam a partida inteira (exploração, lista de
+// pistas, acusação e veredito) sobre as tabelas do caso, repetindo a mesma
+// trilha como "Nivel Mestre --repetir": teclas e acusação vêm da trilha, e
+// pistas coletadas e veredito são conferidos com ela. A versão avulsa é a
+// cópia de bench_motor_mestre_avulso.c; a do motor segue o jogarSessao()
+// do Nivel Mestre.c atual. Cada sessão devolve o número de divergências.
+// As trilhas são gravadas pelo motor antes das medidas, com as teclas de um
+// roteiro e a acusação de montaAcusacao().
+// -----------------------------
+int mestreAvulsoRepetir(const Caso *caso, const Trilha *trilha);
+
+typedef struct Partida {
+    Roteiro *roteiro;       // não NULL: gravação, com as teclas do roteiro
+    Trilha *gravada;
+    const Trilha *trilha;   // repetição
+    size_t proximo;
+    int divergencias;
+} Partida;
+
+static void partidaAnota(Partida *p, int tipo, uint64_t valor, uint64_t extra, const char *texto) {
+    Trilha *t = p->gravada;
+    if (t->numEventos == t->capEventos) {
+        t->capEventos = t->capEventos ? 2 * t->capEventos : 16;
+        TrilhaEvento *novos = (TrilhaEvento*) realloc(t->eventos, t->capEventos * sizeof(TrilhaEvento));
+        if (!novos) {
+            fprintf(stderr, "Erro: sem memória.\n");
+            exit(EXIT_FAILURE);
+        }
+        t->eventos = novos;
+    }
+    TrilhaEvento *e = &t->eventos[t->numEventos++];
+    e->tipo = tipo;
+    e->tempo = 0;
+    e->valor = valor;
+    e->extra = extra;
+    e->texto = texto ? strcpy((char*) aloca(strlen(texto) + 1), texto) : NULL;
+}
+
+static const TrilhaEvento *partidaEsperado(Partida *p, int tipo) {
+    const Trilha *t = p->trilha;
+    if (p->proximo >= t->numEventos || t->eventos[p->proximo].tipo != tipo) {
+        p->divergencias++;
+        return NULL;
+    }
+    return &t->eventos[p->proximo++];
+}
+
+static int partidaEscolha(Partida *p, char *opc) {
+    if (p->roteiro) {
+        leRoteiro(p->roteiro, opc);
+        partidaAnota(p, TRILHA_ESCOLHA, (unsigned char) *opc, 0, NULL);
+        return 1;
+    }
+    const TrilhaEvento *e = partidaEsperado(p, TRILHA_ESCOLHA);
+    *opc = e ? (char) e->valor : 's';
+    return 1;
+}
+
+static void partidaPista(Partida *p, uint32_t sala) {
+    if (p->roteiro) {
+        partidaAnota(p, TRILHA_PISTA, sala, 0, NULL);
+        return;
+    }
+    const TrilhaEvento *e = partidaEsperado(p, TRILHA_PISTA);
+    if (e && e->valor != sala) p->divergencias++;
+}
+
+// resumo das pistas coletadas, como sessaoPistasFinais() do Nivel Mestre.c
+typedef struct ResumoPistas {
+    uint64_t quantidade;
+    uint64_t soma;
+} ResumoPistas;
+
+static void somaResumoPista(void *no, void *contexto) {
+    ResumoPistas *r = (ResumoPistas*) contexto;
+    r->quantidade++;
+    r->soma += trilhaResumoTexto(((PistaNode*) no)->pista);
+}
+
+// uma partida pelo motor; 'acusacao' só é usada na gravação
+static size_t sessaoMotor(const Caso *caso, Partida *p, const char *acusacao) {
+    Mapa mapa = mapaDoCaso(caso);
+    Jogo jogo;
+    jogoInicializar(&jogo, &mapa);
+    jogo.caso = caso;
+    explorarSalas(&jogo, p);
+
+    ResumoPistas r = { 0, 0 };
+    arvoreEmOrdem(jogo.pistas, ARVORE_FILHOS(PistaNode, esq, dir), somaResumoPista, &r);
+    const TrilhaEvento *e;
+    if (p->roteiro) {
+        partidaAnota(p, TRILHA_PISTAS_FINAIS, r.quantidade, r.soma, NULL);
+    } else if ((e = partidaEsperado(p, TRILHA_PISTAS_FINAIS)) && (e->valor != r.quantidade || e->extra != r.soma)) {
+        p->divergencias++;
+    }
+    exibirPistas(jogo.pistas);
+
+    char entrada[128];
+    if (p->roteiro) {
+        snprintf(entrada, sizeof(entrada), "%s", acusacao);
+        partidaAnota(p, TRILHA_ACUSACAO, 0, 0, entrada);
+    } else {
+        e = partidaEsperado(p, TRILHA_ACUSACAO);
+        snprintf(entrada, sizeof(entrada), "%s", e ? e->texto : "");
+    }
+    Julgamento j;
+    julgarAcusacao(&jogo, entrada, &j);
+    if (p->roteiro) {
+        partidaAnota(p, TRILHA_VEREDITO, (uint64_t) j.evidencias, (uint64_t) j.veredito, j.suspeito);
+    } else if ((e = partidaEsperado(p, TRILHA_VEREDITO)) &&
+               (e->valor != (uint64_t) j.evidencias || e->extra != (uint64_t) j.veredito ||
+                strcmp(e->texto, j.suspeito) != 0)) {
+        p->divergencias++;
+    }
+    liberarJogo(&jogo);
+    if (!p->roteiro && p->proximo != p->trilha->numEventos) p->divergencias++;
+    return (size_t) p->divergencias;
+}
+
+// acusação do roteiro 'r': um suspeito do caso digitado de uma de várias formas
+static void montaAcusacao(const Caso *caso, size_t r, char *saida, size_t tamanho) {
+    saida[0] = '\0';
+    if (caso->numSuspeitos == 0) return;
+    snprintf(saida, tamanho, "%s", casoTexto(caso, caso->suspeitos[r % caso->numSuspeitos]));
+    size_t n = strlen(saida);
+    if (n < 2) return;
+    switch ((r / caso->numSuspeitos) % 7) {
+    case 0:                                         // nome exato
+        break;
+    case 1:                                         // tudo em minúsculas
+        for (char *c = saida; *c; ++c) if (*c >= 'A' && *c <= 'Z') *c = (char)(*c - 'A' + 'a');
+        break;
+    case 2:                                         // uma letra a menos
+        memmove(saida + n / 2, saida + n / 2 + 1, n - n / 2);
+        break;
+    case 3: {                                       // duas letras trocadas
+        char t = saida[n / 2];
+        saida[n / 2] = saida[n / 2 - 1];
+        saida[n / 2 - 1] = t;
+        break;
+    }
+    case 4: {                                       // só a primeira palavra (pode ser ambígua)
+        char *espaco = strchr(saida, ' ');
+        if (espaco) *espaco = '\0';
+        break;
+    }
+    case 5:                                         // ninguém do caso
+        snprintf(saida, tamanho, "Ninguém Conhecido");
+        break;
+    default:                                        // sem acusação
+        saida[0] = '\0';
+        break;
+    }
+}
+
+// trilhas gravadas de um caso, uma por roteiro
+typedef struct CasoBench {
+    const Caso *caso;
+    Trilha trilhas[NUM_ROTEIROS];
+} CasoBench;
+
+static CasoBench *gravaTrilhas(const Caso *caso) {
+    CasoBench *c = (CasoBench*) aloca(sizeof(CasoBench));
+    c->caso = caso;
+    for (size_t r = 0; r < NUM_ROTEIROS; ++r) {
+        char acusacao[128];
+        montaAcusacao(caso, r, acusacao, sizeof(acusacao));
+        Roteiro roteiro = { roteiros[r], 0 };
+        Trilha *t = &c->trilhas[r];
+        memset(t, 0, sizeof(*t));
+        t->nomeCaso = strcpy((char*) aloca(1), "");
+        Partida p = { &roteiro, t, NULL, 0, 0 };
+        sessaoMotor(caso, &p, acusacao);
+    }
+    return c;
+}
+
+static void liberaTrilhas(CasoBench *c) {
+    for (size_t r = 0; r < NUM_ROTEIROS; ++r) trilhaLiberar(&c->trilhas[r]);
+    free(c);
+}
+
+// caso grande montado em memória com o construtor (mesma forma do mapa grande)
+static Caso casoGrande(CasoConstrutor *b) {
+    construtorInicializa(b);
+    char id[32];
+    for (size_t i = 0; i < numGrande; ++i) {
+        snprintf(id, sizeof(id), "%zu", i);
+        construtorAdicionarSala(b, id, mapaGrande[i].nome, mapaGrande[i].pista);
+    }
+    const char *suspeitos[] = { "Suspeito A", "Suspeito B", "Suspeito C", "Suspeito D" };
+    for (size_t i = 0; i < numGrande; ++i) {
+        b->salas[i].esquerda = mapaGrande[i].esquerda >= 0 ? (uint32_t) mapaGrande[i].esquerda : CASO_NENHUM;
+        b->salas[i].direita = mapaGrande[i].direita >= 0 ? (uint32_t) mapaGrande[i].direita : CASO_NENHUM;
+        construtorAssociar(b, mapaGrande[i].pista, suspeitos[i % 4]);
+    }
+    if (construtorGerarHashPerfeita(b) != 0) {
+        fprintf(stderr, "Erro: hash perfeita não encontrada.\n");
+        exit(EXIT_FAILURE);
+    }
+    return construtorComoCaso(b);
+}
+#endif
+
+// -----------------------------
+// Medição
+// -----------------------------
+// 'sessao' joga o roteiro de índice dado
+static double mede(size_t (*sessao)(const void*, size_t), const void *arg, size_t numSessoes, size_t *soma) {
+    *soma = 0;
+    double t0 = agora();
+    for (size_t s = 0; s < numSessoes; ++s) *soma += sessao(arg, s % NUM_ROTEIROS);
+    return (agora() - t0) * 1e9 / numSessoes;
+}
+
+#if NIVEL == 3
+static size_t avulsoCaso(const void *arg, size_t roteiro) {
+    const CasoBench *c = (const CasoBench*) arg;
+    return (size_t) mestreAvulsoRepetir(c->caso, &c->trilhas[roteiro]);
+}
+static size_t motorCaso(const void *arg, size_t roteiro) {
+    const CasoBench *c = (const CasoBench*) arg;
+    Partida p = { NULL, NULL, &c->trilhas[roteiro], 0, 0 };
+    return sessaoMotor(c->caso, &p, NULL);
+}
+#else
+typedef struct MapaDescrito {
+    const DescricaoSala *salas;
+    size_t num;
+} MapaDescrito;
+static size_t avulsoMapa(const void *arg, size_t roteiro) {
+    const MapaDescrito *m = (const MapaDescrito*) arg;
+    Roteiro r = { roteiros[roteiro], 0 };
+    return sessaoAvulsa(m->salas, m->num, &r);
+}
+static size_t motorMapa(const void *arg, size_t roteiro) {
+    const MapaDescrito *m = (const MapaDescrito*) arg;
+    Roteiro r = { roteiros[roteiro], 0 };
+    return sessaoMotor(m->salas, m->num, &r);
+}
+#endif
+
+static int compara(const char *rotulo, size_t (*avulso)(const void*, size_t),
+                   size_t (*motor)(const void*, size_t), const void *arg, size_t numSessoes) {
+    size_t somaAvulso, somaMotor;
+    // uma rodada de aquecimento de cada e a medição alternada
+    mede(avulso, arg, numSessoes / 10 + 1, &somaAvulso);
+    mede(motor, arg, numSessoes / 10 + 1, &somaMotor);
+    double tAvulso = mede(avulso, arg, numSessoes, &somaAvulso);
+    double tMotor = mede(motor, arg, numSessoes, &somaMotor);
+    printf("%-22s %14.1f %14.1f %9.2fx\n", rotulo, tAvulso, tMotor, tAvulso / tMotor);
+#if NIVEL == 3
+    // no Mestre as somas são divergências das trilhas: as duas devem ser zero
+    if (somaAvulso != 0 || somaMotor != 0) {
+        fprintf(stderr, "Erro: %zu divergência(s) na versão avulsa e %zu no motor.\n", somaAvulso, somaMotor);
+        return 1;
+    }
+#else
+    if (somaAvulso != somaMotor) {
+        fprintf(stderr, "Erro: resultados divergem (%zu x %zu).\n", somaAvulso, somaMotor);
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    size_t numSessoes = argc > 1 ? strtoul(argv[1], NULL, 10) : 200000;
+    if (numSessoes == 0) {
+        fprintf(stderr, "Uso: %s [numSessoes]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const char *niveis[] = { "", "Novato", "Aventureiro", "Mestre" };
+    montaRoteiros();
+    montaMapaGrande();
+
+    printf("Nível %s: %zu sessões por medida (ns por sessão)\n", niveis[NIVEL], numSessoes);
+    printf("%-22s %14s %14s %10s\n", "mapa", "avulso", "motor", "ganho");
+    int falhas = 0;
+#if NIVEL == 3
+    CasoBench *mansao = gravaTrilhas(&CASO_MANSAO);
+    falhas += compara("caso da mansão", avulsoCaso, motorCaso, mansao, numSessoes);
+    liberaTrilhas(mansao);
+    CasoConstrutor b;
+    Caso grande = casoGrande(&b);
+    CasoBench *trilhasGrande = gravaTrilhas(&grande);
+    falhas += compara("caso de 1023 salas", avulsoCaso, motorCaso, trilhasGrande, numSessoes);
+    liberaTrilhas(trilhasGrande);
+    construtorLiberar(&b);
+#else
+    MapaDescrito nivel = { MAPA_NIVEL, sizeof(MAPA_NIVEL) / sizeof(MAPA_NIVEL[0]) };
+    MapaDescrito grande = { mapaGrande, numGrande };
+    falhas += compara("mapa do nível", avulsoMapa, motorMapa, &nivel, numSessoes);
+    falhas += compara("mapa de 1023 salas", avulsoMapa, motorMapa, &grande, numSessoes / 50 + 1);
+#endif
+
+    for (size_t i = 0; i < numGrande; ++i) {
+        free((char*) mapaGrande[i].nome);
+        free((char*) mapaGrande[i].pista);
+    }
+    free(mapaGrande);
+    return falhas ? EXIT_FAILURE : 0;
+}
@@ -0,0 +1,675 @@
+// nanosleep (trilha_sessao.h) é POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// -----------------------------
+// bench_motor_mestre_avulso.c
+// Lado avulso do bench_motor no Nível Mestre (NIVEL 3): o "Nivel Mestre.c"
+// do commit 9a4260b, o último antes do motor comum, copiado literalmente
+// abaixo da marca "cópia literal". A cópia não é editada; os desvios ficam
+// nos macros antes dela:
+//   - printf não imprime nada (o lado do motor usa MOTOR_TELA vazio);
+//   - main vira mestreAvulsoMain, que ninguém chama.
+// Os vereditos eram definidos em trilha_sessao.h naquele commit; hoje são
+// de motor_jogo.h, então são repetidos aqui com os mesmos valores.
+// Os cabeçalhos do projeto são incluídos antes dos macros, então só o
+// código copiado é afetado por eles (os #include da cópia não fazem nada).
+// O bench joga cada partida com jogarSessao() repetindo uma trilha em
+// memória: teclas e acusação vêm da trilha, e pistas e veredito são
+// conferidos pela própria sessão da cópia.
+// Compilar junto: gcc -O2 -DNIVEL=3 bench_motor.c bench_motor_mestre_avulso.c
+// -----------------------------
+#include "caso.h"
+#include "caso_mansao.h"
+#include "catalogo_casos.h"
+#include "busca_suspeitos.h"
+#include "percurso_arvore.h"
+#include "trilha_sessao.h"
+#include "colacao.h"
+
+enum { VEREDITO_NENHUM = 0, VEREDITO_FRACO, VEREDITO_SUSTENTADO };
+
+int mestreAvulsoRepetir(const Caso *caso, const Trilha *trilha);
+
+// saída descartada: os argumentos são avaliados e somem na otimização
+static inline void telaDescartada(const char *formato, ...) {
+    (void) formato;
+}
+#define printf(...) telaDescartada(__VA_ARGS__)
+#define main mestreAvulsoMain
+
+// ===== cópia literal: "Nivel Mestre.c" em 9a4260b =====
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+// -----------------------------
+// Caso estático
+// O mapa, as pistas e a tabela pista -> suspeito são gerados em tempo de
+// compilação a partir de casos/mansao.txt:
+//   gerador_caso casos/mansao.txt caso_mansao.h CASO_MANSAO
+// Montar o caso não faz nenhuma alocação: as salas são índices em tabelas
+// somente leitura e a consulta de suspeitos usa uma hash perfeita.
+// Outros casos podem ser carregados sob demanda de casos/<nome>.txt pelo
+// catálogo (ver main()).
+// -----------------------------
+#include "caso.h"
+#include "caso_mansao.h"
+#include "catalogo_casos.h"
+
+#include "busca_suspeitos.h"
+#include "percurso_arvore.h"
+#include "trilha_sessao.h"
+
+#define DIRETORIO_CASOS "casos"
+#define DISTANCIA_ACUSACAO 2            // erros de digitação tolerados no nome acusado
+#define ORCAMENTO_CATALOGO (1u << 20)   // 1 MiB de casos carregados
+
+// -----------------------------
+// Ordem das pistas
+// ORDEM_COLACAO 1 (padrão): ordem alfabética do português ("Porão" < "Porta"),
+// com a chave de ordenação calculada uma vez por pista (colacao.h) e
+// comparada com memcmp.
+// ORDEM_COLACAO 0: ordem dos bytes (strcmp), sem chave guardada nos nós.
+// -----------------------------
+#ifndef ORDEM_COLACAO
+#define ORDEM_COLACAO 1
+#endif
+#if ORDEM_COLACAO
+#include "colacao.h"
+#endif
+
+// -----------------------------
+// Estruturas
+// -----------------------------
+
+// Nó da BST que armazena pistas coletadas (sem duplicatas)
+// A pista aponta para o texto internado do caso (não é copiada nem liberada).
+typedef struct PistaNode {
+    const char *pista;
+#if ORDEM_COLACAO
+    unsigned char *chave;   // chave de ordenação (alocada junto com o nó)
+    size_t tamChave;
+#endif
+    struct PistaNode *esq;
+    struct PistaNode *dir;
+} PistaNode;
+
+// -----------------------------
+// Funções utilitárias de string
+// -----------------------------
+
+// copiaString: aloca e retorna uma cópia da string (similar a strdup)
+char *copiaString(const char *s) {
+    if (!s) return NULL;
+    size_t n = strlen(s) + 1;
+    char *c = (char*) malloc(n);
+    if (!c) {
+        fprintf(stderr, "Erro: sem memória para copiar string.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(c, s, n);
+    return c;
+}
+
+// limpaEspaco: remove '\n' final de fgets (se houver)
+void limpaNovaLinha(char *s) {
+    if (!s) return;
+    size_t len = strlen(s);
+    if (len == 0) return;
+    if (s[len - 1] == '\n') s[len - 1] = '\0';
+}
+
+// funçao para leitura segura de linha (stdin)
+void leLinha(char *buffer, size_t tamanho) {
+    if (fgets(buffer, (int)tamanho, stdin) == NULL) {
+        buffer[0] = '\0';
+        return;
+    }
+    limpaNovaLinha(buffer);
+}
+
+// -----------------------------
+// comparaPista()
+// Compara a pista procurada com a de um nó, na ordem escolhida por ORDEM_COLACAO.
+// Com colação, 'chave' é a chave já calculada da pista procurada.
+// -----------------------------
+#if ORDEM_COLACAO
+static int comparaPista(const unsigned char *chave, size_t tamChave, const PistaNode *n) {
+    return colacaoCompara(chave, tamChave, n->chave, n->tamChave);
+}
+#else
+static int comparaPista(const char *pista, const PistaNode *n) {
+    return strcmp(pista, n->pista);
+}
+#endif
+
+// -----------------------------
+// BST: inserirPista()
+// Insere uma pista na BST de pistas coletadas em ordem alfabética.
+// Evita duplicatas (se já existe, não insere).
+// A pista deve viver tanto quanto a árvore (texto do caso).
+// Com colação, a chave é calculada uma única vez aqui e guardada no nó.
+// Retorna a raiz (possivelmente nova).
+// -----------------------------
+PistaNode* inserirPista(PistaNode *raiz, const char *pista) {
+    if (pista == NULL) return raiz;
+#if ORDEM_COLACAO
+    size_t tamChave = colacaoChave(pista, NULL, 0);
+    PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode) + tamChave);
+    if (!n) {
+        fprintf(stderr, "Erro ao alocar nó de pista.\n");
+        exit(EXIT_FAILURE);
+    }
+    n->chave = (unsigned char*)(n + 1);
+    n->tamChave = colacaoChave(pista, n->chave, tamChave);
+#endif
+
+    // desce até a posição da nova pista
+    PistaNode **pos = &raiz;
+    while (*pos) {
+#if ORDEM_COLACAO
+        int cmp = comparaPista(n->chave, n->tamChave, *pos);
+#else
+        int cmp = comparaPista(pista, *pos);
+#endif
+        if (cmp == 0) {
+            // igual => duplicata; não inserir
+#if ORDEM_COLACAO
+            free(n);
+#endif
+            return raiz;
+        }
+        pos = cmp < 0 ? &(*pos)->esq : &(*pos)->dir;
+    }
+
+#if !ORDEM_COLACAO
+    PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode));
+    if (!n) {
+        fprintf(stderr, "Erro ao alocar nó de pista.\n");
+        exit(EXIT_FAILURE);
+    }
+#endif
+    n->pista = pista;
+    n->esq = n->dir = NULL;
+    *pos = n;
+    return raiz;
+}
+
+// -----------------------------
+// pistaColetada()
+// Busca uma pista na BST (1 se já foi coletada, 0 caso contrário)
+// -----------------------------
+int pistaColetada(const PistaNode *raiz, const char *pista) {
+#if ORDEM_COLACAO
+    // chave em buffer local; só aloca se a pista for muito longa
+    unsigned char local[COLACAO_MAX_PILHA];
+    unsigned char *chave = local;
+    size_t tamChave = colacaoChave(pista, local, sizeof(local));
+    if (tamChave > sizeof(local)) chave = colacaoChaveAlocada(pista, &tamChave);
+#endif
+    int achou = 0;
+    while (raiz && !achou) {
+#if ORDEM_COLACAO
+        int cmp = comparaPista(chave, tamChave, raiz);
+#else
+        int cmp = comparaPista(pista, raiz);
+#endif
+        if (cmp == 0) achou = 1;
+        else raiz = cmp < 0 ? raiz->esq : raiz->dir;
+    }
+#if ORDEM_COLACAO
+    if (chave != local) free(chave);
+#endif
+    return achou;
+}
+
+// -----------------------------
+// exibirPistas()
+// Imprime as pistas coletadas (in-order traversal => ordem alfabética;
+// com ORDEM_COLACAO, acentos e maiúsculas seguem a ordem do português).
+// Percurso de Morris (percurso_arvore.h): sem recursão, qualquer profundidade.
+// -----------------------------
+void imprimirPista(void *no, void *contexto) {
+    (void) contexto;
+    printf(" - %s\n", ((PistaNode*) no)->pista);
+}
+
+void exibirPistas(PistaNode *raiz) {
+    arvoreEmOrdem(raiz, ARVORE_FILHOS(PistaNode, esq, dir), imprimirPista, NULL);
+}
+
+// -----------------------------
+// liberarPistas()
+// Libera memória da BST de pistas, sem recursão (a chave está na mesma
+// alocação do nó e o texto pertence ao caso: basta free() em cada nó)
+// -----------------------------
+void liberarPistas(PistaNode *raiz) {
+    arvoreLiberar(raiz, ARVORE_FILHOS(PistaNode, esq, dir), NULL, NULL);
+}
+
+// -----------------------------
+// Sessão: gravação e repetição (trilha_sessao.h)
+// Todas as entradas do jogador passam por aqui. Gravando, cada escolha,
+// pista coletada e acusação vira um evento da trilha. Repetindo, as entradas
+// vêm da trilha e cada resultado é conferido com o que foi gravado; as
+// diferenças são contadas em 'divergencias'.
+// -----------------------------
+typedef struct Sessao {
+    TrilhaGravador gravador;
+    int gravando;
+    const Trilha *trilha;       // não NULL: repetição
+    size_t proximo;             // próximo evento da trilha
+    int ritmo;                  // repete com os intervalos gravados
+    uint64_t inicio;            // relógio da repetição
+    int divergencias;
+} Sessao;
+
+// sessaoEsperado: (repetição) consome o próximo evento, que deve ser do tipo indicado
+static const TrilhaEvento *sessaoEsperado(Sessao *s, int tipo) {
+    const Trilha *t = s->trilha;
+    if (s->proximo >= t->numEventos || t->eventos[s->proximo].tipo != tipo) {
+        fprintf(stderr, "Divergência: evento %zu deveria ser do tipo %d.\n", s->proximo, tipo);
+        s->divergencias++;
+        return NULL;
+    }
+    const TrilhaEvento *e = &t->eventos[s->proximo++];
+    if (s->ritmo) {
+        uint64_t decorrido = trilhaAgora() - s->inicio;
+        if (e->tempo > decorrido) trilhaEspera(e->tempo - decorrido);
+    }
+    return e;
+}
+
+static void sessaoDivergencia(Sessao *s, const char *oque, const TrilhaEvento *e) {
+    fprintf(stderr, "Divergência no evento %zu (%s).\n", (size_t)(e - s->trilha->eventos), oque);
+    s->divergencias++;
+}
+
+// sessaoEscolha: lê a tecla de navegação (1 = lida, 0 = entrada inválida)
+int sessaoEscolha(Sessao *s, char *opc) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_ESCOLHA);
+        *opc = e ? (char) e->valor : 's';   // trilha acabou ou divergiu: encerra a exploração
+        return 1;
+    }
+    if (scanf(" %c", opc) != 1) return 0;
+    if (s->gravando) {
+        TrilhaEvento e = { TRILHA_ESCOLHA, 0, (unsigned char) *opc, 0, NULL };
+        trilhaGravar(&s->gravador, &e);
+    }
+    return 1;
+}
+
+// sessaoPista: registra (ou confere) a coleta da pista de uma sala
+void sessaoPista(Sessao *s, uint32_t sala) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_PISTA);
+        if (e && e->valor != sala) sessaoDivergencia(s, "pista coletada", e);
+    } else if (s->gravando) {
+        TrilhaEvento e = { TRILHA_PISTA, 0, sala, 0, NULL };
+        trilhaGravar(&s->gravador, &e);
+    }
+}
+
+// sessaoPistasFinais: registra (ou confere) quantidade e resumo das pistas coletadas
+typedef struct ResumoPistas {
+    uint64_t quantidade;
+    uint64_t soma;
+} ResumoPistas;
+
+void somaResumoPista(void *no, void *contexto) {
+    ResumoPistas *r = (ResumoPistas*) contexto;
+    r->quantidade++;
+    r->soma += trilhaResumoTexto(((PistaNode*) no)->pista);
+}
+
+void sessaoPistasFinais(Sessao *s, PistaNode *arvorePistas) {
+    if (!s->trilha && !s->gravando) return;
+    ResumoPistas r = { 0, 0 };
+    arvoreEmOrdem(arvorePistas, ARVORE_FILHOS(PistaNode, esq, dir), somaResumoPista, &r);
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_PISTAS_FINAIS);
+        if (e && (e->valor != r.quantidade || e->extra != r.soma)) sessaoDivergencia(s, "pistas coletadas", e);
+    } else {
+        TrilhaEvento e = { TRILHA_PISTAS_FINAIS, 0, r.quantidade, r.soma, NULL };
+        trilhaGravar(&s->gravador, &e);
+    }
+}
+
+// sessaoAcusacao: lê o nome acusado
+void sessaoAcusacao(Sessao *s, char *entrada, size_t tamanho) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_ACUSACAO);
+        snprintf(entrada, tamanho, "%s", e ? e->texto : "");
+        return;
+    }
+    // limpar buffer remanescente
+    int ch;
+    while ((ch = getchar()) != '\n' && ch != EOF);
+    leLinha(entrada, tamanho);
+    if (s->gravando) {
+        TrilhaEvento e = { TRILHA_ACUSACAO, 0, 0, 0, entrada };
+        trilhaGravar(&s->gravador, &e);
+    }
+}
+
+// sessaoVeredito: registra (ou confere) evidências, veredito e suspeito considerado
+void sessaoVeredito(Sessao *s, int contador, int veredito, const char *suspeito) {
+    if (s->trilha) {
+        const TrilhaEvento *e = sessaoEsperado(s, TRILHA_VEREDITO);
+        if (e && (e->valor != (uint64_t) contador || e->extra != (uint64_t) veredito ||
+                  strcmp(e->texto, suspeito) != 0)) sessaoDivergencia(s, "veredito", e);
+    } else if (s->gravando) {
+        TrilhaEvento e = { TRILHA_VEREDITO, 0, (uint64_t) contador, (uint64_t) veredito, (char*) suspeito };
+        trilhaGravar(&s->gravador, &e);
+    }
+}
+
+// -----------------------------
+// explorarSalas()
+// Navega interativamente pelo mapa do caso (a partir da sala 0), coleta pistas
+// automaticamente e as adiciona na BST de pistas coletadas.
+// Uma pista já presente na BST conta como coletada (as tabelas do caso são
+// somente leitura, então nada é marcado nas salas).
+// As escolhas vêm de sessaoEscolha() (teclado ou trilha) e cada pista coletada
+// é registrada na sessão.
+// -----------------------------
+void explorarSalas(const Caso *caso, PistaNode **arvorePistas, Sessao *sessao) {
+    if (!caso || caso->numSalas == 0) return;
+    char opc;
+    uint32_t pos = 0;
+
+    while (pos != CASO_NENHUM) {
+        const CasoSala *sala = &caso->salas[pos];
+        const char *pista = casoTexto(caso, sala->pista);
+        printf("\nVocê está na sala: %s\n", caso->textos + sala->nome);
+
+        // Se existir pista ainda não coletada, coleta automaticamente (insere na BST)
+        if (pista != NULL && !pistaColetada(*arvorePistas, pista)) {
+            printf("Pista encontrada: \"%s\"\n", pista);
+            *arvorePistas = inserirPista(*arvorePistas, pista);
+            sessaoPista(sessao, pos);
+        } else {
+            printf("Nenhuma pista nova nesta sala.\n");
+        }
+
+        // Mostra opções
+        printf("\nOpções:\n");
+        if (sala->esquerda != CASO_NENHUM)
+            printf(" (e) Ir para %s (esquerda)\n", caso->textos + caso->salas[sala->esquerda].nome);
+        if (sala->direita != CASO_NENHUM)
+            printf(" (d) Ir para %s (direita)\n", caso->textos + caso->salas[sala->direita].nome);
+        printf(" (s) Sair e ir ao julgamento\n");
+        printf("Escolha: ");
+
+        if (!sessaoEscolha(sessao, &opc)) {
+            int ch;
+            while ((ch = getchar()) != '\n' && ch != EOF);
+            printf("Entrada inválida. Tente novamente.\n");
+            continue;
+        }
+
+        if (opc == 'e' || opc == 'E') {
+            if (sala->esquerda != CASO_NENHUM) pos = sala->esquerda;
+            else printf("Não há caminho à esquerda.\n");
+        } else if (opc == 'd' || opc == 'D') {
+            if (sala->direita != CASO_NENHUM) pos = sala->direita;
+            else printf("Não há caminho à direita.\n");
+        } else if (opc == 's' || opc == 'S') {
+            printf("Exploração encerrada pelo jogador.\n");
+            break;
+        } else {
+            printf("Opção inválida. Use 'e', 'd' ou 's'.\n");
+        }
+    }
+}
+
+// -----------------------------
+// verificarSuspeitoFinal()
+// Conta quantas pistas coletadas apontam para o suspeito indicado: percorre a
+// BST com arvoreContar() (percurso_arvore.h) consultando a hash perfeita do caso.
+// Retorna o número de pistas que apontam para o suspeito.
+// -----------------------------
+typedef struct Acusacao {
+    const Caso *caso;
+    const char *suspeito;
+} Acusacao;
+
+int pistaApontaSuspeito(const void *no, void *contexto) {
+    const Acusacao *a = (const Acusacao*) contexto;
+    const char *s = casoEncontrarSuspeito(a->caso, ((const PistaNode*) no)->pista);
+    return s && strcmp(s, a->suspeito) == 0;
+}
+
+int verificarSuspeitoFinal(PistaNode *arvorePistas, const Caso *caso, const char *suspeito) {
+    Acusacao a = { caso, suspeito };
+    return (int) arvoreContar(arvorePistas, ARVORE_FILHOS(PistaNode, esq, dir), pistaApontaSuspeito, &a);
+}
+
+// -----------------------------
+// interpretarSuspeito()
+// Aceita o nome digitado com erros de digitação, maiúsculas/minúsculas ou
+// acentos trocados: procura os suspeitos do caso a até DISTANCIA_ACUSACAO
+// edições (busca_suspeitos.h). Retorna o nome oficial se houver um único mais
+// próximo; em caso de empate lista os candidatos e retorna NULL.
+// -----------------------------
+const char *interpretarSuspeito(const Caso *caso, const char *entrada) {
+    IndiceSuspeitos ix;
+    indiceSuspeitosInicializar(&ix);
+    for (uint32_t i = 0; i < caso->numSuspeitos; ++i) {
+        indiceSuspeitosAdicionar(&ix, casoTexto(caso, caso->suspeitos[i]));
+    }
+    indiceSuspeitosConstruir(&ix);
+
+    ResultadoSuspeito res[4];
+    int num = indiceSuspeitosBuscar(&ix, entrada, DISTANCIA_ACUSACAO, res, 4);
+    const char *nome = NULL;
+    if (num == 1 || (num > 1 && res[1].distancia > res[0].distancia)) {
+        nome = casoTexto(caso, caso->suspeitos[res[0].indice]);
+    } else if (num > 1) {
+        printf("Nome ambíguo. Você quis dizer:");
+        for (int i = 0; i < num && res[i].distancia == res[0].distancia; ++i) {
+            printf("%s%s", i ? ", " : " ", res[i].nome);
+        }
+        printf("?\n");
+    }
+    indiceSuspeitosLiberar(&ix);
+    return nome;
+}
+
+// -----------------------------
+// jogarSessao()
+// Uma partida completa: exploração, pistas coletadas, acusação e veredito.
+// As entradas e resultados passam pela sessão (gravação ou repetição).
+// -----------------------------
+void jogarSessao(const Caso *caso, Sessao *sessao) {
+    // ---------- BST de pistas coletadas (inicialmente vazia) ----------
+    PistaNode *arvorePistas = NULL;
+
+    // ---------- Início do jogo ----------
+    printf("=========================================\n");
+    printf(" 🕵️  DETECTIVE QUEST - MODO MESTRE\n");
+    printf("=========================================\n");
+    printf("Explore a mansão e colete pistas. Ao final, acuse o suspeito.\n");
+    printf("Navegue com: 'e' (esquerda), 'd' (direita) ou 's' (sair).\n");
+
+    explorarSalas(caso, &arvorePistas, sessao);
+    sessaoPistasFinais(sessao, arvorePistas);
+
+    // Exibe pistas coletadas
+    printf("\n\n===== PISTAS COLETADAS =====\n");
+    if (arvorePistas == NULL) {
+        printf("Nenhuma pista coletada.\n");
+    } else {
+        exibirPistas(arvorePistas);
+    }
+
+    // Solicita acusação do jogador
+    char entrada[128];
+    printf("\nDigite o nome do suspeito que você deseja acusar (ex.: Suspeito A):\n> ");
+    sessaoAcusacao(sessao, entrada, sizeof(entrada));
+    if (strlen(entrada) == 0) {
+        printf("Nenhum suspeito informado. Encerrando.\n");
+        sessaoVeredito(sessao, 0, VEREDITO_NENHUM, "");
+    } else {
+        // Conta quantas pistas coletadas apontam para o suspeito indicado
+        const char *oficial = interpretarSuspeito(caso, entrada);
+        if (oficial && strcmp(oficial, entrada) != 0) printf("Interpretado como: %s\n", oficial);
+        char *suspeito = copiaString(oficial ? oficial : entrada); // cópia para segurança
+        int contador = verificarSuspeitoFinal(arvorePistas, caso, suspeito);
+
+        printf("\nVocê acusou: %s\n", suspeito);
+        printf("Evidências encontradas que apontam para %s: %d\n", suspeito, contador);
+
+        if (contador >= 2) {
+            printf("\nResultado: ACUSAÇÃO SUSTENTADA. Parece que você tem evidências suficientes!\n");
+        } else {
+            printf("\nResultado: ACUSAÇÃO FRACA. Poucas evidências. Falta prova contundente.\n");
+        }
+        sessaoVeredito(sessao, contador, contador >= 2 ? VEREDITO_SUSTENTADO : VEREDITO_FRACO, suspeito);
+        free(suspeito);
+    }
+
+    // ---------- Limpeza de memória ----------
+    liberarPistas(arvorePistas);
+}
+
+// -----------------------------
+// Função principal
+// Usa o caso estático ou o caso pedido na linha de comando (mapa + hash
+// pista -> suspeito) e joga uma partida, gravando-a se pedido:
+//   Nivel Mestre [caso] [--gravar trilha.dqt]
+// Ou repete uma trilha gravada (mesmo caso da gravação), conferindo pistas e
+// veredito; a saída do jogo vai para stdout e o resumo para stderr:
+//   Nivel Mestre --repetir trilha.dqt [--ritmo] [--vezes N]
+// --ritmo respeita os intervalos gravados; sem ele a repetição é a toda velocidade.
+// -----------------------------
+int main(int argc, char **argv) {
+    const char *nomeCaso = NULL, *gravar = NULL, *repetir = NULL;
+    int ritmo = 0;
+    long vezes = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--gravar") == 0 && i + 1 < argc) gravar = argv[++i];
+        else if (strcmp(argv[i], "--repetir") == 0 && i + 1 < argc) repetir = argv[++i];
+        else if (strcmp(argv[i], "--vezes") == 0 && i + 1 < argc) vezes = strtol(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--ritmo") == 0) ritmo = 1;
+        else if (argv[i][0] != '-' && !nomeCaso) nomeCaso = argv[i];
+        else {
+            fprintf(stderr, "Uso: %s [caso] [--gravar trilha]\n"
+                            "     %s --repetir trilha [--ritmo] [--vezes N]\n", argv[0], argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (vezes < 1) vezes = 1;
+
+    // ---------- Trilha a repetir (define o caso) ----------
+    Trilha trilha;
+    if (repetir) {
+        FILE *f = fopen(repetir, "rb");
+        char erro[128];
+        if (!f) {
+            fprintf(stderr, "Erro: não foi possível abrir a trilha '%s'.\n", repetir);
+            return EXIT_FAILURE;
+        }
+        int r = trilhaCarregar(f, &trilha, erro, sizeof(erro));
+        fclose(f);
+        if (r != 0) {
+            fprintf(stderr, "Erro na trilha '%s': %s.\n", repetir, erro);
+            return EXIT_FAILURE;
+        }
+        nomeCaso = trilha.nomeCaso[0] ? trilha.nomeCaso : NULL;
+    }
+
+    // ---------- Mapa e tabela pista -> suspeito ----------
+    // Sem nome de caso, ambos vêm de caso_mansao.h (tabelas estáticas): nenhuma alocação aqui.
+    // Com um nome de caso, ele é carregado de casos/<nome>.txt pelo catálogo.
+    const Caso *caso = &CASO_MANSAO;
+    Catalogo catalogo;
+    CatalogoCaso *casoAberto = NULL;
+    if (nomeCaso) {
+        catalogoInicializar(&catalogo, ORCAMENTO_CATALOGO, catalogoCarregadorArquivos, (void*) DIRETORIO_CASOS);
+        casoAberto = catalogoAbrir(&catalogo, nomeCaso);
+        if (!casoAberto) {
+            fprintf(stderr, "Erro: caso '%s' não encontrado em %s/.\n", nomeCaso, DIRETORIO_CASOS);
+            catalogoLiberar(&catalogo);
+            if (repetir) trilhaLiberar(&trilha);
+            return EXIT_FAILURE;
+        }
+        caso = casoAberto->caso;
+    }
+
+    Sessao sessao;
+    memset(&sessao, 0, sizeof(sessao));
+    int status = EXIT_SUCCESS;
+    if (repetir) {
+        // ---------- Repetição ----------
+        sessao.trilha = &trilha;
+        sessao.ritmo = ritmo;
+        uint64_t t0 = trilhaAgora();
+        for (long v = 0; v < vezes; ++v) {
+            sessao.proximo = 0;
+            sessao.inicio = trilhaAgora();
+            jogarSessao(caso, &sessao);
+            if (sessao.proximo != trilha.numEventos) {
+                fprintf(stderr, "Divergência: %zu eventos da trilha não foram usados.\n",
+                        trilha.numEventos - sessao.proximo);
+                sessao.divergencias++;
+            }
+        }
+        double total = (double)(trilhaAgora() - t0);
+        double gravado = trilha.numEventos ? (double) trilha.eventos[trilha.numEventos - 1].tempo : 0.0;
+        fprintf(stderr, "\nrepetição de %s: %ld vez(es), %zu eventos cada, %s\n", repetir, vezes,
+                trilha.numEventos, ritmo ? "no ritmo gravado" : "a toda velocidade");
+        fprintf(stderr, "tempo: %.3f ms por sessão (gravada em %.3f ms), %.1f eventos/s\n",
+                total / vezes / 1000.0, gravado / 1000.0, total > 0 ? trilha.numEventos * vezes * 1e6 / total : 0.0);
+        fprintf(stderr, "conferência: %s (%d divergência(s))\n",
+                sessao.divergencias ? "FALHOU" : "pistas e veredito conferem", sessao.divergencias);
+        if (sessao.divergencias) status = EXIT_FAILURE;
+        trilhaLiberar(&trilha);
+    } else {
+        // ---------- Partida (opcionalmente gravada) ----------
+        FILE *saida = NULL;
+        if (gravar) {
+            saida = fopen(gravar, "wb");
+            if (!saida) {
+                fprintf(stderr, "Erro: não foi possível criar a trilha '%s'.\n", gravar);
+                status = EXIT_FAILURE;
+            } else {
+                trilhaGravadorAbrir(&sessao.gravador, saida, nomeCaso ? nomeCaso : "");
+                sessao.gravando = 1;
+            }
+        }
+        if (status == EXIT_SUCCESS) jogarSessao(caso, &sessao);
+        if (saida && fclose(saida) != 0) {
+            fprintf(stderr, "Erro ao gravar a trilha '%s'.\n", gravar);
+            status = EXIT_FAILURE;
+        }
+        if (status == EXIT_SUCCESS) printf("\nObrigado por jogar Detective Quest - Modo Mestre!\n");
+    }
+
+    if (casoAberto) {
+        catalogoFechar(&catalogo, casoAberto);
+        catalogoLiberar(&catalogo);
+    }
+    return status;
+}
+// ===== fim da cópia literal =====
+
+// -----------------------------
+// mestreAvulsoRepetir()
+// Joga uma partida da cópia repetindo a trilha a toda velocidade.
+// Retorna o número de divergências (0 = mesmas pistas e mesmo veredito).
+// -----------------------------
+int mestreAvulsoRepetir(const Caso *caso, const Trilha *trilha) {
+    Sessao sessao;
+    memset(&sessao, 0, sizeof(sessao));
+    sessao.trilha = trilha;
+    jogarSessao(caso, &sessao);
+    if (sessao.proximo != trilha->numEventos) sessao.divergencias++;
+    return sessao.divergencias;
+}
@@ -0,0 +1,261 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "percurso_arvore.h"
+
+// -----------------------------
+// bench_percurso.c
+// Exercita os percursos de percurso_arvore.h em estruturas com um milhão de
+// níveis, que estourariam a pilha com as versões recursivas:
+//   - corredor de salas (cada sala só tem saída à direita) e ziguezague
+//   - BST de pistas degenerada (inserção crescente e decrescente)
+//   - BST aleatória, para comparar com um percurso de pilha explícita
+// Confere ordem, contagem e que a árvore volta intacta depois do percurso.
+//
+// Uso: bench_percurso [numNos]      (padrão: 1000000)
+//   compilar: gcc -O2 bench_percurso.c -o bench_percurso
+// -----------------------------
+
+// nós com ponteiros só para este benchmark: os níveis guardam as salas em um
+// vetor com índices e as pistas com chave de colação (motor_jogo.h); aqui
+// interessam apenas árvores encadeadas profundas para os percursos
+typedef struct Sala {
+    char nome[50];
+    struct Sala *esquerda;
+    struct Sala *direita;
+} Sala;
+
+typedef struct PistaNode {
+    char *pista;
+    struct PistaNode *esq;
+    struct PistaNode *dir;
+} PistaNode;
+
+static unsigned long long estado = 88172645463325252ULL;
+static unsigned long long aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 2685821657736338717ULL;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *aloca(size_t n) {
+    void *p = malloc(n);
+    if (!p) {
+        fprintf(stderr, "Erro: sem memória.\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+static void falha(const char *msg) {
+    fprintf(stderr, "Erro: %s\n", msg);
+    exit(EXIT_FAILURE);
+}
+
+// -----------------------------
+// Salas
+// -----------------------------
+// corredor: 'zigue' alterna o lado de cada saída
+static Sala *criaCorredor(size_t n, int zigue) {
+    Sala *primeira = NULL, **saida = &primeira;
+    for (size_t i = 0; i < n; ++i) {
+        Sala *s = (Sala*) aloca(sizeof(Sala));
+        snprintf(s->nome, sizeof(s->nome), "Sala %zu", i);
+        s->esquerda = s->direita = NULL;
+        *saida = s;
+        saida = (zigue && i % 2) ? &s->esquerda : &s->direita;
+    }
+    return primeira;
+}
+
+static size_t liberadas;
+static void liberaSala(void *no, void *contexto) {
+    (void) contexto;
+    liberadas++;
+    free(no);
+}
+
+// -----------------------------
+// Pistas
+// -----------------------------
+static PistaNode *inserirPista(PistaNode *raiz, char *pista) {
+    PistaNode **pos = &raiz;
+    while (*pos) {
+        int cmp = strcmp(pista, (*pos)->pista);
+        if (cmp == 0) {
+            free(pista);
+            return raiz;
+        }
+        pos = cmp < 0 ? &(*pos)->esq : &(*pos)->dir;
+    }
+    PistaNode *n = (PistaNode*) aloca(sizeof(PistaNode));
+    n->pista = pista;
+    n->esq = n->dir = NULL;
+    *pos = n;
+    return raiz;
+}
+
+// modo: 0 = crescente (lista pela direita), 1 = decrescente (pela esquerda), 2 = aleatória.
+// As degeneradas são montadas já encadeadas: é a forma que a inserção em ordem
+// produziria, sem os O(n^2) passos de descer a lista a cada inserção.
+static PistaNode *criaPistas(size_t n, int modo) {
+    char buffer[32];
+    if (modo != 2) {
+        PistaNode *raiz = NULL, **pos = &raiz;
+        for (size_t i = 0; i < n; ++i) {
+            snprintf(buffer, sizeof(buffer), "Pista %09zu", modo == 1 ? n - 1 - i : i);
+            PistaNode *no = (PistaNode*) aloca(sizeof(PistaNode));
+            no->pista = (char*) aloca(strlen(buffer) + 1);
+            strcpy(no->pista, buffer);
+            no->esq = no->dir = NULL;
+            *pos = no;
+            pos = modo == 1 ? &no->esq : &no->dir;
+        }
+        return raiz;
+    }
+    size_t *ordem = (size_t*) aloca(n * sizeof(size_t));
+    for (size_t i = 0; i < n; ++i) ordem[i] = i;
+    for (size_t i = n - 1; i > 0; --i) {
+        size_t j = aleatorio() % (i + 1), t = ordem[i];
+        ordem[i] = ordem[j];
+        ordem[j] = t;
+    }
+    PistaNode *raiz = NULL;
+    for (size_t i = 0; i < n; ++i) {
+        snprintf(buffer, sizeof(buffer), "Pista %09zu", ordem[i]);
+        char *p = (char*) aloca(strlen(buffer) + 1);
+        strcpy(p, buffer);
+        raiz = inserirPista(raiz, p);
+    }
+    free(ordem);
+    return raiz;
+}
+
+// visitante: confere ordem crescente e conta
+typedef struct Conferencia {
+    const char *anterior;
+    size_t visitados;
+    int foraDeOrdem;
+} Conferencia;
+
+static void confere(void *no, void *contexto) {
+    Conferencia *c = (Conferencia*) contexto;
+    const char *p = ((PistaNode*) no)->pista;
+    if (c->anterior && strcmp(c->anterior, p) >= 0) c->foraDeOrdem = 1;
+    c->anterior = p;
+    c->visitados++;
+}
+
+// predicado: pistas de número par
+static int pistaPar(const void *no, void *contexto) {
+    (void) contexto;
+    const char *p = ((const PistaNode*) no)->pista;
+    return (p[strlen(p) - 1] - '0') % 2 == 0;
+}
+
+// soma de verificação da forma da árvore (iterativa, pilha explícita)
+static unsigned long long forma(PistaNode *raiz, size_t n) {
+    PistaNode **pilha = (PistaNode**) aloca((n + 1) * sizeof(PistaNode*));
+    size_t topo = 0;
+    unsigned long long h = 1469598103934665603ULL;
+    if (raiz) pilha[topo++] = raiz;
+    while (topo) {
+        PistaNode *no = pilha[--topo];
+        h = (h ^ (unsigned long long)(size_t) no->esq) * 1099511628211ULL;
+        h = (h ^ (unsigned long long)(size_t) no->dir) * 1099511628211ULL;
+        if (no->esq) pilha[topo++] = no->esq;
+        if (no->dir) pilha[topo++] = no->dir;
+    }
+    free(pilha);
+    return h;
+}
+
+// referência: em ordem com pilha explícita do tamanho da árvore
+static size_t emOrdemPilha(PistaNode *raiz, size_t n) {
+    PistaNode **pilha = (PistaNode**) aloca((n + 1) * sizeof(PistaNode*));
+    size_t topo = 0, visitados = 0;
+    PistaNode *no = raiz;
+    while (no || topo) {
+        while (no) { pilha[topo++] = no; no = no->esq; }
+        no = pilha[--topo];
+        visitados += no->pista[0] != '\0';
+        no = no->dir;
+    }
+    free(pilha);
+    return visitados;
+}
+
+static size_t pistasLiberadas;
+static void liberaPista(void *no, void *contexto) {
+    (void) contexto;
+    pistasLiberadas++;
+    free(((PistaNode*) no)->pista);
+    free(no);
+}
+
+int main(int argc, char **argv) {
+    size_t n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    if (n == 0) {
+        fprintf(stderr, "Uso: %s [numNos]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // salas: só a liberação percorre o mapa inteiro
+    printf("%zu salas\n", n);
+    printf("%-26s %16s\n", "mapa", "liberação (ns/nó)");
+    for (int zigue = 0; zigue < 2; ++zigue) {
+        Sala *mapa = criaCorredor(n, zigue);
+        liberadas = 0;
+        double t0 = agora();
+        arvoreLiberar(mapa, ARVORE_FILHOS(Sala, esquerda, direita), liberaSala, NULL);
+        double t = (agora() - t0) * 1e9 / n;
+        if (liberadas != n) falha("salas liberadas não conferem");
+        printf("%-26s %16.1f\n", zigue ? "ziguezague" : "corredor (só direita)", t);
+    }
+
+    // pistas: em ordem, contagem e liberação
+    const char *nomes[] = { "BST crescente", "BST decrescente", "BST aleatória" };
+    printf("\n%zu pistas\n", n);
+    printf("%-18s %14s %14s %14s %14s\n", "árvore", "Morris (ns)", "pilha (ns)", "contagem (ns)", "liberação (ns)");
+    for (int modo = 0; modo < 3; ++modo) {
+        PistaNode *raiz = criaPistas(n, modo);
+        unsigned long long antes = forma(raiz, n);
+
+        Conferencia c = { NULL, 0, 0 };
+        double t0 = agora();
+        arvoreEmOrdem(raiz, ARVORE_FILHOS(PistaNode, esq, dir), confere, &c);
+        double tMorris = (agora() - t0) * 1e9 / n;
+        if (c.visitados != n || c.foraDeOrdem) falha("percurso em ordem incorreto");
+        if (forma(raiz, n) != antes) falha("percurso de Morris não restaurou a árvore");
+
+        t0 = agora();
+        size_t visitados = emOrdemPilha(raiz, n);
+        double tPilha = (agora() - t0) * 1e9 / n;
+        if (visitados != n) falha("percurso de referência incorreto");
+
+        t0 = agora();
+        size_t pares = arvoreContar(raiz, ARVORE_FILHOS(PistaNode, esq, dir), pistaPar, NULL);
+        double tConta = (agora() - t0) * 1e9 / n;
+        if (pares != (n + 1) / 2) falha("contagem incorreta");
+
+        pistasLiberadas = 0;
+        t0 = agora();
+        arvoreLiberar(raiz, ARVORE_FILHOS(PistaNode, esq, dir), liberaPista, NULL);
+        double tLibera = (agora() - t0) * 1e9 / n;
+        if (pistasLiberadas != n) falha("pistas liberadas não conferem");
+
+        printf("%-18s %14.1f %14.1f %14.1f %14.1f\n", nomes[modo], tMorris, tPilha, tConta, tLibera);
+    }
+    printf("\nconferência: ordem, contagem, forma restaurada e liberação corretas\n");
+    return 0;
+}
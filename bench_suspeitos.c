@@ -0,0 +1,272 @@
+// clock_gettime e CLOCK_MONOTONIC são POSIX (fora do -std=c11 puro)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include "busca_suspeitos.h"
+
+// -----------------------------
+// bench_suspeitos.c
+// Mede a busca aproximada de suspeitos (busca_suspeitos.h) com muitos nomes
+// distintos de 1, 2 e 3 palavras (primeiros nomes e sobrenomes comuns
+// aparecem com frequência). Classes de consulta:
+//   - nome de 3 palavras com 1 ou 2 erros de digitação e caixa trocada;
+//   - nome de 1 ou 2 palavras com 1 ou 2 erros;
+//   - consultas curtas (3 a 6 caracteres): primeiros nomes comuns, exatos
+//     ou com 1 erro, e palavras curtas quaisquer;
+//   - primeiro nome + sobrenome comuns ("Ana Silva"), exatos ou com 1 erro.
+// Informa tempo médio, p99 e máximo por classe e a revocação (quantas vezes
+// o nome de origem, quando existe no índice, veio entre os resultados).
+// Cada consulta roda 3 vezes e vale o menor tempo (descarta interrupções do
+// sistema). Termina com erro se o máximo passar de LIMITE_US.
+//
+// Uso: bench_suspeitos [numNomes] [numConsultas]    (padrão: 1000000 10000)
+//   compilar: gcc -O2 bench_suspeitos.c -o bench_suspeitos
+// -----------------------------
+
+#define DISTANCIA_MAXIMA 2
+#define MAX_RESULTADOS 5
+#ifndef LIMITE_US
+#define LIMITE_US 1000.0
+#endif
+
+static const char *silabas[] = {
+    "ma", "ri", "a", "na", "jo", "se", "lu", "ci", "pe", "dro", "car", "los", "fer", "nan", "da",
+    "al", "ber", "to", "sou", "za", "li", "ma", "sil", "va", "gon", "ça", "ves", "ro", "dri", "gues",
+    "be", "a", "triz", "he", "le", "no", "mo", "rei", "ra", "cos", "ta", "ba", "rão", "tei", "xei"
+};
+static const char *primeirosNomes[] = {
+    "Ana", "José", "Maria", "João", "Rui", "Eva", "Luís", "Pedro", "Paulo", "Carla", "Rita", "Inês",
+    "Hugo", "Bia", "Léo", "Caio", "Davi", "Lara", "Júlia", "Marta", "Tiago", "Sofia", "Bruno", "Diogo",
+    "Igor", "Ivo", "Gil", "Téo", "Zé", "Lia"
+};
+static const char *sobrenomes[] = {
+    "Silva", "Santos", "Souza", "Costa", "Lima", "Dias", "Rocha", "Alves", "Gomes", "Reis", "Sá", "Luz"
+};
+#define NUM(v) (sizeof(v) / sizeof((v)[0]))
+
+enum { LONGOS, CURTOS_NOMES, CURTAS, NOME_SOBRENOME, NUM_CLASSES };
+static const char *rotulos[NUM_CLASSES] = {
+    "3 palavras, 1-2 erros", "1-2 palavras, 1-2 erros", "curtas (3-6 caracteres)", "nome + sobrenome comuns"
+};
+
+static unsigned long long estado = 88172645463325252ULL;
+static unsigned long long aleatorio(void) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 2685821657736338717ULL;
+}
+
+static double agora(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// palavra de 2 a 4 sílabas com inicial maiúscula
+static size_t geraPalavra(char *dest) {
+    size_t n = 0;
+    int num = 2 + (int)(aleatorio() % 3);
+    for (int i = 0; i < num; ++i) {
+        const char *s = silabas[aleatorio() % NUM(silabas)];
+        size_t t = strlen(s);
+        memcpy(dest + n, s, t);
+        n += t;
+    }
+    dest[0] = (char) toupper((unsigned char) dest[0]);
+    return n;
+}
+
+// aplica 'erros' edições ASCII (troca, inserção ou remoção) e inverte a caixa da inicial
+static void erraDigitacao(const char *orig, char *dest, int erros) {
+    strcpy(dest, orig);
+    for (int e = 0; e < erros; ++e) {
+        size_t n = strlen(dest);
+        size_t i = aleatorio() % n;
+        if ((unsigned char) dest[i] >= 0x80) continue;   // não quebra sequências UTF-8
+        char letra = (char)('a' + aleatorio() % 26);
+        switch (aleatorio() % 3) {
+        case 0: dest[i] = letra; break;
+        case 1: memmove(dest + i + 1, dest + i, n - i + 1); dest[i] = letra; break;
+        default: memmove(dest + i, dest + i + 1, n - i); break;
+        }
+    }
+    if (isupper((unsigned char) dest[0])) dest[0] = (char) tolower((unsigned char) dest[0]);
+}
+
+// nome de 1 a 3 palavras; o primeiro é comum em 60% dos casos e o último em 50%
+static int geraNome(char *dest) {
+    unsigned long long r = aleatorio();
+    int palavras = r % 100 < 15 ? 1 : (r % 100 < 50 ? 2 : 3);
+    size_t n = 0;
+    for (int p = 0; p < palavras; ++p) {
+        if (p > 0) dest[n++] = ' ';
+        unsigned long long s = aleatorio();
+        if (p == 0 && palavras > 1 && s % 10 < 6) n += (size_t) sprintf(dest + n, "%s", primeirosNomes[(s >> 8) % NUM(primeirosNomes)]);
+        else if (p == palavras - 1 && p > 0 && s % 2) n += (size_t) sprintf(dest + n, "%s", sobrenomes[(s >> 8) % NUM(sobrenomes)]);
+        else n += geraPalavra(dest + n);
+    }
+    dest[n] = '\0';
+    return palavras;
+}
+
+// conjunto de nomes já inseridos (os nomes do índice são distintos)
+typedef struct Vistos {
+    uint64_t *h;
+    size_t cap;
+} Vistos;
+
+static uint64_t hashNome(const char *s) {
+    uint64_t h = 14695981039346656037ULL;
+    for (; *s; ++s) h = (h ^ (unsigned char) *s) * 1099511628211ULL;
+    return h | 1;
+}
+
+static int insereVisto(Vistos *v, const char *s) {
+    uint64_t h = hashNome(s);
+    size_t j = (size_t)(h >> 20) & (v->cap - 1);
+    while (v->h[j]) {
+        if (v->h[j] == h) return 0;
+        j = (j + 1) & (v->cap - 1);
+    }
+    v->h[j] = h;
+    return 1;
+}
+
+static int comparaDouble(const void *a, const void *b) {
+    double x = *(const double*) a, y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    size_t numNomes = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    size_t numConsultas = argc > 2 ? strtoul(argv[2], NULL, 10) : 10000;
+    if (numNomes == 0 || numConsultas == 0) {
+        fprintf(stderr, "Uso: %s [numNomes] [numConsultas]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    IndiceSuspeitos ix;
+    indiceSuspeitosInicializar(&ix);
+    Vistos vistos = { NULL, 1 };
+    while (vistos.cap < numNomes * 2) vistos.cap *= 2;
+    vistos.h = (uint64_t*) calloc(vistos.cap, sizeof(uint64_t));
+    uint32_t *porPalavras[2];   // nomes de 1-2 palavras e de 3 palavras
+    size_t numPorPalavras[2] = { 0, 0 };
+    porPalavras[0] = (uint32_t*) malloc(numNomes * sizeof(uint32_t));
+    porPalavras[1] = (uint32_t*) malloc(numNomes * sizeof(uint32_t));
+    char nome[160];
+    // os primeiros nomes comuns e as combinações nome + sobrenome comuns existem sempre
+    for (size_t i = 0; i < NUM(primeirosNomes) && ix.numNomes < numNomes; ++i) {
+        insereVisto(&vistos, primeirosNomes[i]);
+        porPalavras[0][numPorPalavras[0]++] = indiceSuspeitosAdicionar(&ix, primeirosNomes[i]);
+    }
+    for (size_t i = 0; i < NUM(primeirosNomes) * NUM(sobrenomes) && ix.numNomes < numNomes; ++i) {
+        snprintf(nome, sizeof(nome), "%s %s", primeirosNomes[i / NUM(sobrenomes)], sobrenomes[i % NUM(sobrenomes)]);
+        insereVisto(&vistos, nome);
+        porPalavras[0][numPorPalavras[0]++] = indiceSuspeitosAdicionar(&ix, nome);
+    }
+    while (ix.numNomes < numNomes) {
+        int palavras = geraNome(nome);
+        if (!insereVisto(&vistos, nome)) continue;
+        uint32_t id = indiceSuspeitosAdicionar(&ix, nome);
+        porPalavras[palavras == 3][numPorPalavras[palavras == 3]++] = id;
+    }
+    free(vistos.h);
+    double t0 = agora();
+    if (indiceSuspeitosConstruir(&ix) != 0) {
+        fprintf(stderr, "Erro: nomes demais para o índice de suspeitos.\n");
+        return EXIT_FAILURE;
+    }
+    printf("%zu nomes, índice montado em %.2f s\n", numNomes, agora() - t0);
+
+    double *tempos[NUM_CLASSES];
+    size_t num[NUM_CLASSES] = { 0 }, comAlvo[NUM_CLASSES] = { 0 }, achados[NUM_CLASSES] = { 0 };
+    double soma[NUM_CLASSES] = { 0.0 };
+    for (int k = 0; k < NUM_CLASSES; ++k) tempos[k] = (double*) malloc(numConsultas * sizeof(double));
+    ResultadoSuspeito res[MAX_RESULTADOS];
+    char consulta[160], maisLenta[160] = "";
+    double tempoMaisLenta = 0.0;
+    for (size_t c = 0; c < numConsultas; ++c) {
+        int classe = (int)(c % NUM_CLASSES);
+        const char *alvo = NULL;   // nome de origem da consulta, se estiver no índice
+        unsigned long long r = aleatorio();
+        if (classe == LONGOS && numPorPalavras[1] > 0) {
+            alvo = ix.nomes + ix.offNome[porPalavras[1][r % numPorPalavras[1]]];
+            erraDigitacao(alvo, consulta, 1 + (int)((r >> 32) % 2));
+        } else if (classe == CURTOS_NOMES || classe == LONGOS) {
+            alvo = ix.nomes + ix.offNome[porPalavras[0][r % numPorPalavras[0]]];
+            erraDigitacao(alvo, consulta, 1 + (int)((r >> 32) % 2));
+        } else if (classe == CURTAS) {
+            if ((r >> 32) % 3 == 0) {
+                // palavra curta qualquer: prefixo de 3 a 6 caracteres de uma palavra gerada
+                size_t n = geraPalavra(consulta);
+                size_t corte = 3 + (size_t)((r >> 40) % 4);
+                consulta[n < corte ? n : corte] = '\0';
+            } else {
+                alvo = primeirosNomes[r % NUM(primeirosNomes)];
+                if ((r >> 32) % 3 == 1) erraDigitacao(alvo, consulta, 1);
+                else strcpy(consulta, alvo);
+            }
+        } else {
+            snprintf(nome, sizeof(nome), "%s %s", primeirosNomes[r % NUM(primeirosNomes)],
+                     sobrenomes[(r >> 16) % NUM(sobrenomes)]);
+            alvo = nome;
+            if ((r >> 32) % 2) erraDigitacao(alvo, consulta, 1);
+            else strcpy(consulta, alvo);
+        }
+
+        double melhor = 0.0;
+        int encontrados = 0;
+        for (int rep = 0; rep < 3; ++rep) {
+            t0 = agora();
+            encontrados = indiceSuspeitosBuscar(&ix, consulta, DISTANCIA_MAXIMA, res, MAX_RESULTADOS);
+            double t = (agora() - t0) * 1e6;
+            if (rep == 0 || t < melhor) melhor = t;
+        }
+        tempos[classe][num[classe]++] = melhor;
+        if (melhor > tempoMaisLenta) {
+            tempoMaisLenta = melhor;
+            strcpy(maisLenta, consulta);
+        }
+        soma[classe] += melhor;
+
+        if (alvo) {
+            comAlvo[classe]++;
+            for (int i = 0; i < encontrados; ++i) {
+                if (strcmp(res[i].nome, alvo) == 0) {
+                    achados[classe]++;
+                    break;
+                }
+            }
+        }
+    }
+
+    printf("%zu consultas (distância máxima %d), tempos em us\n", numConsultas, DISTANCIA_MAXIMA);
+    printf("%-26s %8s %10s %10s %10s %11s\n", "classe", "consultas", "média", "p99", "máximo", "revocação");
+    double pior = 0.0;
+    for (int k = 0; k < NUM_CLASSES; ++k) {
+        if (num[k] == 0) continue;
+        qsort(tempos[k], num[k], sizeof(double), comparaDouble);
+        double maximo = tempos[k][num[k] - 1];
+        if (maximo > pior) pior = maximo;
+        printf("%-26s %8zu %10.1f %10.1f %10.1f %10.2f%%\n", rotulos[k], num[k], soma[k] / num[k],
+               tempos[k][(size_t)(num[k] * 0.99)], maximo, comAlvo[k] ? 100.0 * achados[k] / comAlvo[k] : 100.0);
+        free(tempos[k]);
+    }
+    printf("revocação: nome de origem entre os %d primeiros; máximo geral %.1f us (limite %.0f us)\n",
+           MAX_RESULTADOS, pior, LIMITE_US);
+    printf("consulta mais lenta: \"%s\"\n", maisLenta);
+
+    free(porPalavras[0]);
+    free(porPalavras[1]);
+    indiceSuspeitosLiberar(&ix);
+    if (pior > LIMITE_US) {
+        fprintf(stderr, "Erro: consulta mais lenta (%.1f us) acima do limite de %.0f us.\n", pior, LIMITE_US);
+        return EXIT_FAILURE;
+    }
+    return 0;
+}
@@ -0,0 +1,729 @@
+#ifndef BUSCA_SUSPEITOS_H
+#define BUSCA_SUSPEITOS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "colacao.h"
+
+// -----------------------------
+// busca_suspeitos.h
+// Busca aproximada de nomes de suspeitos (tolerante a erros de digitação,
+// maiúsculas/minúsculas e acentos).
+//
+// 1. Os nomes são normalizados (letra base minúscula, sem acento; ver colacao.h).
+// 2. Pré-filtro por trigramas: cada edição estraga no máximo 3 trigramas, então
+//    entre quaisquer L trigramas da consulta um nome a distância <= k
+//    compartilha pelo menos L - 3k. São usadas as listas dos
+//    L = 3k+1+SUSPEITOS_FOLGA trigramas mais raros da consulta. Só quem
+//    aparece em uma das 3k+1 mais raras pode chegar a L - 3k: essas listas
+//    geram os candidatos, e as demais só são percorridas enquanto forem
+//    mais baratas que confirmar os candidatos diretamente.
+// 3. Consultas curtas (m <= 3k+2) deixam o filtro por trigramas fraco demais
+//    (mínimo de 1 trigrama em comum, ou nenhum). Para elas há uma vizinhança
+//    de remoções: cada nome curto é indexado por todas as formas obtidas
+//    removendo até SUSPEITOS_VIZ_K caracteres; um nome a distância <= k
+//    compartilha com a consulta uma forma com no máximo k remoções de cada
+//    lado, então basta procurar as formas da consulta. Com menos de
+//    SUSPEITOS_VIZ_MIN_NOMES nomes a vizinhança não é montada: conferir
+//    todos os nomes custa menos que gerar as formas (os poucos suspeitos de
+//    um caso, por exemplo).
+// 4. Os candidatos passam antes por uma assinatura de 32 bits com as letras
+//    do nome (uma edição muda no máximo uma letra de cada lado) e são
+//    confirmados com a distância de edição (Levenshtein) bit-paralela de
+//    Myers/Hyyrö (consultas de até 64 bytes; acima disso, programação
+//    dinâmica comum). Assinaturas e textos normalizados ficam na ordem dos
+//    postos (por tamanho), então a confirmação lê memória próxima.
+//
+// Uso: indiceSuspeitosAdicionar() para cada nome, indiceSuspeitosConstruir()
+// uma vez e então indiceSuspeitosBuscar() quantas vezes quiser. As buscas
+// usam áreas de trabalho do índice: um índice não deve ser consultado por
+// duas threads ao mesmo tempo.
+// -----------------------------
+
+#define SUSPEITOS_Q 3
+#define SUSPEITOS_INICIO '\x02'     // preenchimento antes do nome
+#define SUSPEITOS_FIM '\x03'        // preenchimento depois do nome
+#define SUSPEITOS_MAX_CONSULTA 256
+#ifndef SUSPEITOS_FOLGA
+#define SUSPEITOS_FOLGA 4           // trigramas extras percorridos além dos 3k+1
+#endif
+#ifndef SUSPEITOS_VIZ_K
+#define SUSPEITOS_VIZ_K 2           // maior distância atendida pela vizinhança de remoções
+#endif
+// nomes mais longos que isso nunca estão a distância <= k de uma consulta curta
+#define SUSPEITOS_VIZ_MAX_TAM (4 * SUSPEITOS_VIZ_K + 2)
+#ifndef SUSPEITOS_VIZ_MIN_NOMES
+#define SUSPEITOS_VIZ_MIN_NOMES 1024 // abaixo disso consultas curtas conferem todos os nomes
+#endif
+#ifndef SUSPEITOS_CUSTO_VERIFICA
+#define SUSPEITOS_CUSTO_VERIFICA 8  // uma confirmação custa ~ tantos passos de lista
+#endif
+
+typedef struct ResultadoSuspeito {
+    const char *nome;       // nome original (interno ao índice)
+    uint32_t indice;        // ordem de inserção
+    int distancia;          // distância de edição entre as formas normalizadas
+} ResultadoSuspeito;
+
+typedef struct IndiceSuspeitos {
+    // nomes originais e normalizados (blocos contínuos + deslocamentos)
+    char *nomes;
+    size_t tamNomes, capNomes;
+    char *normalizados;
+    size_t tamNorm, capNorm;
+    uint32_t *offNome, *offNorm;
+    uint32_t *tamNormalizado;
+    uint32_t numNomes, capIndices;
+
+    // trigramas: hash aberta trigrama -> faixa em 'postagens'
+    uint32_t *chaves;          // trigrama (24 bits) + 1; 0 = vazio
+    uint32_t *inicio;          // início da lista de cada trigrama
+    uint32_t *contagem;        // tamanho da lista de cada trigrama
+    uint32_t capTrigramas;
+    uint32_t *postagens;       // postos dos nomes, cada lista em ordem crescente
+
+    // posto: posição do nome na ordem por tamanho normalizado (estável). As
+    // listas e as marcas usam postos, então uma busca só toca a faixa
+    // contígua de postos dos tamanhos compatíveis.
+    uint32_t *idDoPosto;
+    uint32_t *offPosto;        // por posto: início do texto normalizado (numNomes + 1 posições;
+                               // 'normalizados' fica na ordem dos postos)
+    uint32_t *assinatura;      // por posto: conjunto de letras do nome (ver suspeitosAssinatura)
+    uint32_t inicioTamanho[SUSPEITOS_MAX_CONSULTA + 2];   // primeiro posto de cada tamanho
+
+    // vizinhança de remoções dos nomes curtos: resumos (ordenados) -> postos
+    uint32_t *vizResumos;      // resumos distintos das formas
+    uint32_t *vizInicio;       // faixa de cada resumo em 'vizIds' (numViz + 1 posições)
+    uint32_t *vizIds;
+    uint32_t numViz;
+    uint32_t *vizDiretorio;    // 16 bits altos do resumo -> faixa em 'vizResumos' (65537 posições;
+                               // NULL sem vizinhança)
+
+    // áreas de trabalho das buscas
+    uint8_t *marca;            // por posto: em quantas listas apareceu (satura em 255; 0 fora da busca)
+    uint32_t *candidatos;      // postos marcados pela busca atual (zerados ao final)
+    int construido;
+} IndiceSuspeitos;
+
+// -----------------------------
+// Utilitários
+// -----------------------------
+static inline void *suspeitosRealloc(void *p, size_t n) {
+    void *r = realloc(p, n ? n : 1);
+    if (!r) {
+        fprintf(stderr, "Erro: sem memória no índice de suspeitos.\n");
+        exit(EXIT_FAILURE);
+    }
+    return r;
+}
+
+// normaliza 's' em 'dest' (até cap-1 bytes); retorna o tamanho escrito
+static inline size_t suspeitosNormaliza(const char *s, char *dest, size_t cap) {
+    const unsigned char *p = (const unsigned char*) s;
+    size_t n = 0;
+    while (*p && n + 4 < cap) {
+        ColacaoPeso w = colacaoPeso(p);
+        if (w.letra) dest[n++] = (char) w.letra;
+        else for (size_t k = 0; k < w.tamanho; ++k) dest[n++] = (char) p[k];
+        p += w.tamanho;
+    }
+    dest[n] = '\0';
+    return n;
+}
+
+// trigrama na posição i do texto preenchido (SUSPEITOS_Q-1 marcas de cada lado)
+static inline uint32_t suspeitosTrigrama(const char *norm, size_t tam, size_t i) {
+    uint32_t g = 0;
+    for (size_t k = i; k < i + SUSPEITOS_Q; ++k) {
+        unsigned char c;
+        if (k < SUSPEITOS_Q - 1) c = SUSPEITOS_INICIO;
+        else if (k - (SUSPEITOS_Q - 1) < tam) c = (unsigned char) norm[k - (SUSPEITOS_Q - 1)];
+        else c = SUSPEITOS_FIM;
+        g = (g << 8) | c;
+    }
+    return g;
+}
+
+// número de trigramas de um texto normalizado de tamanho 'tam'
+static inline size_t suspeitosNumTrigramas(size_t tam) {
+    return tam + SUSPEITOS_Q - 1;
+}
+
+// conjunto de caracteres de um texto normalizado em 32 bits: 'a'..'z', espaço
+// e os demais bytes espalhados em 5 bits. Cada edição põe ou tira no máximo
+// um caractere, então a distância é pelo menos o número de bits que só um
+// dos lados tem (juntar caracteres num mesmo bit só enfraquece o limite).
+static inline uint32_t suspeitosAssinatura(const char *norm, size_t tam) {
+    uint32_t a = 0;
+    for (size_t i = 0; i < tam; ++i) {
+        unsigned char c = (unsigned char) norm[i];
+        if (c >= 'a' && c <= 'z') a |= 1u << (c - 'a');
+        else if (c == ' ') a |= 1u << 26;
+        else a |= 1u << (27 + c % 5);
+    }
+    return a;
+}
+
+static inline int suspeitosBits(uint32_t v) {
+    int n = 0;
+    for (; v; v &= v - 1) n++;
+    return n;
+}
+
+static inline uint32_t suspeitosEspalha(uint32_t g) {
+    g ^= g >> 16;
+    g *= 0x7feb352du;
+    g ^= g >> 15;
+    g *= 0x846ca68bu;
+    g ^= g >> 16;
+    return g;
+}
+
+// posição do trigrama na hash aberta (vazia se ainda não existir)
+static inline uint32_t suspeitosPosicao(const IndiceSuspeitos *ix, uint32_t g) {
+    uint32_t m = ix->capTrigramas - 1;
+    uint32_t j = suspeitosEspalha(g) & m;
+    while (ix->chaves[j] != 0 && ix->chaves[j] != g + 1) j = (j + 1) & m;
+    return j;
+}
+
+// dobra a hash de trigramas (1024 posições na primeira vez), reposicionando as contagens
+static inline void suspeitosCresceTrigramas(IndiceSuspeitos *ix) {
+    uint32_t antigaCap = ix->capTrigramas;
+    uint32_t *antigasChaves = ix->chaves, *antigasContagens = ix->contagem;
+    ix->capTrigramas = antigaCap ? antigaCap * 2 : 1024;
+    ix->chaves = (uint32_t*) calloc(ix->capTrigramas, sizeof(uint32_t));
+    ix->contagem = (uint32_t*) calloc(ix->capTrigramas, sizeof(uint32_t));
+    if (!ix->chaves || !ix->contagem) {
+        fprintf(stderr, "Erro: sem memória no índice de suspeitos.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (uint32_t i = 0; i < antigaCap; ++i) {
+        if (antigasChaves[i] == 0) continue;
+        uint32_t j = suspeitosPosicao(ix, antigasChaves[i] - 1);
+        ix->chaves[j] = antigasChaves[i];
+        ix->contagem[j] = antigasContagens[i];
+    }
+    free(antigasChaves);
+    free(antigasContagens);
+}
+
+// -----------------------------
+// Vizinhança de remoções
+// Cada forma (texto com até SUSPEITOS_VIZ_K caracteres removidos) é guardada
+// só pelo seu resumo FNV-1a de 32 bits: uma colisão traz um candidato a mais,
+// que a confirmação descarta, mas nunca esconde um nome.
+// -----------------------------
+static inline uint32_t suspeitosResumo(const char *s, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; ++i) h = (h ^ (unsigned char) s[i]) * 16777619u;
+    return h;
+}
+
+// resumos distintos das formas de 'texto' com até 'k' remoções (k <= 2);
+// 'saida' precisa de espaço para 1 + n + n(n-1)/2 resumos. Retorna quantos.
+static inline size_t suspeitosFormas(const char *texto, size_t n, int k, uint32_t *saida) {
+    char forma[SUSPEITOS_VIZ_MAX_TAM + 1];
+    size_t num = 0;
+    saida[num++] = suspeitosResumo(texto, n);
+    for (size_t i = 0; k >= 1 && i < n; ++i) {
+        // repetições (ex.: "aa") geram a mesma forma: só a primeira posição conta
+        if (i > 0 && texto[i] == texto[i - 1]) continue;
+        memcpy(forma, texto, i);
+        memcpy(forma + i, texto + i + 1, n - i - 1);
+        saida[num++] = suspeitosResumo(forma, n - 1);
+        for (size_t j = i; k >= 2 && j < n - 1; ++j) {
+            if (j > i && forma[j] == forma[j - 1]) continue;
+            char removido[SUSPEITOS_VIZ_MAX_TAM + 1];
+            memcpy(removido, forma, j);
+            memcpy(removido + j, forma + j + 1, n - 2 - j);
+            saida[num++] = suspeitosResumo(removido, n - 2);
+        }
+    }
+    // ordena e remove repetidos (poucos elementos: inserção)
+    for (size_t a = 1; a < num; ++a) {
+        uint32_t v = saida[a];
+        size_t b = a;
+        while (b > 0 && saida[b - 1] > v) { saida[b] = saida[b - 1]; b--; }
+        saida[b] = v;
+    }
+    size_t distintos = 0;
+    for (size_t a = 0; a < num; ++a)
+        if (distintos == 0 || saida[distintos - 1] != saida[a]) saida[distintos++] = saida[a];
+    return distintos;
+}
+
+#define SUSPEITOS_VIZ_MAX_FORMAS (1 + SUSPEITOS_VIZ_MAX_TAM + SUSPEITOS_VIZ_MAX_TAM * (SUSPEITOS_VIZ_MAX_TAM - 1) / 2)
+
+// monta vizResumos/vizInicio/vizIds: pares (resumo, posto) ordenados por radix
+// (2 passadas de 16 bits, estável: postos crescentes dentro de cada resumo).
+// Retorna -1 se as formas não couberem em índices de 32 bits.
+static inline int suspeitosConstroiVizinhanca(IndiceSuspeitos *ix) {
+    uint32_t formas[SUSPEITOS_VIZ_MAX_FORMAS];
+    // só os postos dos nomes curtos (os primeiros na ordem por tamanho)
+    uint32_t numCurtos = ix->inicioTamanho[SUSPEITOS_VIZ_MAX_TAM + 1];
+    size_t total = 0;
+    for (uint32_t r = 0; r < numCurtos; ++r) {
+        uint32_t i = ix->idDoPosto[r];
+        total += suspeitosFormas(ix->normalizados + ix->offNorm[i], ix->tamNormalizado[i], SUSPEITOS_VIZ_K, formas);
+    }
+    if (total > UINT32_MAX) return -1;
+
+    uint64_t *pares = (uint64_t*) suspeitosRealloc(NULL, total * sizeof(uint64_t));
+    uint64_t *aux = (uint64_t*) suspeitosRealloc(NULL, total * sizeof(uint64_t));
+    size_t n = 0;
+    for (uint32_t r = 0; r < numCurtos; ++r) {
+        uint32_t i = ix->idDoPosto[r];
+        size_t f = suspeitosFormas(ix->normalizados + ix->offNorm[i], ix->tamNormalizado[i], SUSPEITOS_VIZ_K, formas);
+        for (size_t a = 0; a < f; ++a) pares[n++] = ((uint64_t) formas[a] << 32) | r;
+    }
+    uint32_t *contagem = (uint32_t*) suspeitosRealloc(NULL, 65536 * sizeof(uint32_t));
+    for (int passada = 0; passada < 2; ++passada) {
+        int desloc = 32 + 16 * passada;
+        memset(contagem, 0, 65536 * sizeof(uint32_t));
+        for (size_t a = 0; a < total; ++a) contagem[(pares[a] >> desloc) & 0xFFFF]++;
+        uint32_t soma = 0;
+        for (size_t d = 0; d < 65536; ++d) { uint32_t c = contagem[d]; contagem[d] = soma; soma += c; }
+        for (size_t a = 0; a < total; ++a) aux[contagem[(pares[a] >> desloc) & 0xFFFF]++] = pares[a];
+        uint64_t *t = pares; pares = aux; aux = t;
+    }
+    free(aux);
+    free(contagem);
+
+    uint32_t distintos = 0;
+    for (size_t a = 0; a < total; ++a)
+        if (a == 0 || (pares[a] >> 32) != (pares[a - 1] >> 32)) distintos++;
+    ix->numViz = distintos;
+    ix->vizResumos = (uint32_t*) suspeitosRealloc(NULL, distintos * sizeof(uint32_t));
+    ix->vizInicio = (uint32_t*) suspeitosRealloc(NULL, (distintos + 1) * sizeof(uint32_t));
+    ix->vizIds = (uint32_t*) suspeitosRealloc(NULL, total * sizeof(uint32_t));
+    ix->vizDiretorio = (uint32_t*) suspeitosRealloc(NULL, 65537 * sizeof(uint32_t));
+    uint32_t r = 0;
+    for (size_t a = 0; a < total; ++a) {
+        if (a == 0 || (pares[a] >> 32) != (pares[a - 1] >> 32)) {
+            ix->vizResumos[r] = (uint32_t)(pares[a] >> 32);
+            ix->vizInicio[r++] = (uint32_t) a;
+        }
+        ix->vizIds[a] = (uint32_t) pares[a];
+    }
+    ix->vizInicio[distintos] = (uint32_t) total;
+    free(pares);
+    for (uint32_t d = 0, a = 0; d <= 65536; ++d) {
+        while (a < distintos && (ix->vizResumos[a] >> 16) < d) a++;
+        ix->vizDiretorio[d] = a;
+    }
+    return 0;
+}
+
+// -----------------------------
+// Montagem
+// -----------------------------
+static inline void indiceSuspeitosInicializar(IndiceSuspeitos *ix) {
+    memset(ix, 0, sizeof(*ix));
+}
+
+static inline void indiceSuspeitosLiberar(IndiceSuspeitos *ix) {
+    free(ix->nomes);
+    free(ix->normalizados);
+    free(ix->offNome);
+    free(ix->offNorm);
+    free(ix->tamNormalizado);
+    free(ix->chaves);
+    free(ix->inicio);
+    free(ix->contagem);
+    free(ix->postagens);
+    free(ix->idDoPosto);
+    free(ix->offPosto);
+    free(ix->assinatura);
+    free(ix->vizResumos);
+    free(ix->vizInicio);
+    free(ix->vizIds);
+    free(ix->vizDiretorio);
+    free(ix->marca);
+    free(ix->candidatos);
+    indiceSuspeitosInicializar(ix);
+}
+
+// indiceSuspeitosAdicionar: copia o nome para o índice e retorna seu número
+static inline uint32_t indiceSuspeitosAdicionar(IndiceSuspeitos *ix, const char *nome) {
+    char norm[SUSPEITOS_MAX_CONSULTA];
+    size_t tamNorm = suspeitosNormaliza(nome, norm, sizeof(norm));
+    size_t tam = strlen(nome) + 1;
+
+    if (ix->numNomes == ix->capIndices) {
+        ix->capIndices = ix->capIndices ? ix->capIndices * 2 : 64;
+        ix->offNome = (uint32_t*) suspeitosRealloc(ix->offNome, ix->capIndices * sizeof(uint32_t));
+        ix->offNorm = (uint32_t*) suspeitosRealloc(ix->offNorm, ix->capIndices * sizeof(uint32_t));
+        ix->tamNormalizado = (uint32_t*) suspeitosRealloc(ix->tamNormalizado, ix->capIndices * sizeof(uint32_t));
+    }
+    if (ix->tamNomes + tam > ix->capNomes) {
+        ix->capNomes = (ix->capNomes + tam) * 2;
+        ix->nomes = (char*) suspeitosRealloc(ix->nomes, ix->capNomes);
+    }
+    if (ix->tamNorm + tamNorm + 1 > ix->capNorm) {
+        ix->capNorm = (ix->capNorm + tamNorm + 1) * 2;
+        ix->normalizados = (char*) suspeitosRealloc(ix->normalizados, ix->capNorm);
+    }
+    ix->offNome[ix->numNomes] = (uint32_t) ix->tamNomes;
+    memcpy(ix->nomes + ix->tamNomes, nome, tam);
+    ix->tamNomes += tam;
+    ix->offNorm[ix->numNomes] = (uint32_t) ix->tamNorm;
+    memcpy(ix->normalizados + ix->tamNorm, norm, tamNorm + 1);
+    ix->tamNorm += tamNorm + 1;
+    ix->tamNormalizado[ix->numNomes] = (uint32_t) tamNorm;
+    ix->construido = 0;
+    return ix->numNomes++;
+}
+
+// -----------------------------
+// indiceSuspeitosConstruir()
+// Monta as listas de trigramas (contagem, prefixos e preenchimento).
+// Deve ser chamada depois das inserções e antes das buscas. Retorna 0 em
+// sucesso ou -1 se os nomes passarem do que índices de 32 bits endereçam;
+// nesse caso o índice fica não construído e as buscas não acham nada.
+// (Falta de memória encerra o programa, como no resto do jogo.)
+// -----------------------------
+static inline int indiceSuspeitosConstruir(IndiceSuspeitos *ix) {
+    ix->construido = 0;
+    size_t total = 0;
+    for (uint32_t i = 0; i < ix->numNomes; ++i) total += suspeitosNumTrigramas(ix->tamNormalizado[i]);
+    if (total > UINT32_MAX || ix->tamNorm > UINT32_MAX) return -1;
+
+    free(ix->chaves);
+    free(ix->inicio);
+    free(ix->contagem);
+    free(ix->postagens);
+    free(ix->idDoPosto);
+    free(ix->offPosto);
+    free(ix->assinatura);
+    free(ix->vizResumos);
+    free(ix->vizInicio);
+    free(ix->vizIds);
+    free(ix->vizDiretorio);
+    ix->vizResumos = ix->vizInicio = ix->vizIds = ix->vizDiretorio = NULL;
+    ix->numViz = 0;
+    ix->capTrigramas = 0;
+    ix->chaves = ix->contagem = NULL;
+    uint32_t distintos = 0;
+    suspeitosCresceTrigramas(ix);
+
+    // 1ª passada: conta ocorrências de cada trigrama
+    for (uint32_t i = 0; i < ix->numNomes; ++i) {
+        const char *norm = ix->normalizados + ix->offNorm[i];
+        size_t tam = ix->tamNormalizado[i];
+        for (size_t k = 0; k < suspeitosNumTrigramas(tam); ++k) {
+            uint32_t g = suspeitosTrigrama(norm, tam, k);
+            uint32_t j = suspeitosPosicao(ix, g);
+            if (ix->chaves[j] == 0) {
+                if ((distintos + 1) * 2 > ix->capTrigramas) {   // mantém carga <= 1/2
+                    suspeitosCresceTrigramas(ix);
+                    j = suspeitosPosicao(ix, g);
+                }
+                ix->chaves[j] = g + 1;
+                distintos++;
+            }
+            ix->contagem[j]++;
+        }
+    }
+    ix->inicio = (uint32_t*) suspeitosRealloc(NULL, ix->capTrigramas * sizeof(uint32_t));
+    ix->postagens = (uint32_t*) suspeitosRealloc(NULL, total * sizeof(uint32_t));
+    uint32_t cap = ix->capTrigramas;
+
+    // prefixos
+    uint32_t soma = 0;
+    for (uint32_t j = 0; j < cap; ++j) {
+        ix->inicio[j] = soma;
+        soma += ix->contagem[j];
+        ix->contagem[j] = 0;
+    }
+    // 2ª passada: postos por tamanho normalizado (ordenação por contagem) e
+    // preenchimento das listas na ordem dos postos, para que cada lista fique
+    // crescente e a busca possa recortar só a faixa de tamanhos compatíveis
+    memset(ix->inicioTamanho, 0, sizeof(ix->inicioTamanho));
+    for (uint32_t i = 0; i < ix->numNomes; ++i) ix->inicioTamanho[ix->tamNormalizado[i] + 1]++;
+    for (size_t t = 1; t <= SUSPEITOS_MAX_CONSULTA + 1; ++t) ix->inicioTamanho[t] += ix->inicioTamanho[t - 1];
+    uint32_t proximo[SUSPEITOS_MAX_CONSULTA + 1];
+    memcpy(proximo, ix->inicioTamanho, sizeof(proximo));
+    ix->idDoPosto = (uint32_t*) suspeitosRealloc(NULL, ix->numNomes * sizeof(uint32_t));
+    ix->assinatura = (uint32_t*) suspeitosRealloc(NULL, ix->numNomes * sizeof(uint32_t));
+    for (uint32_t i = 0; i < ix->numNomes; ++i) ix->idDoPosto[proximo[ix->tamNormalizado[i]]++] = i;
+    // textos normalizados regravados na ordem dos postos: a confirmação de um
+    // candidato lê o deslocamento e o texto sem passar pelo número do nome
+    char *porPosto = (char*) suspeitosRealloc(NULL, ix->tamNorm);
+    ix->offPosto = (uint32_t*) suspeitosRealloc(NULL, ((size_t) ix->numNomes + 1) * sizeof(uint32_t));
+    uint32_t pos = 0;
+    for (uint32_t r = 0; r < ix->numNomes; ++r) {
+        uint32_t i = ix->idDoPosto[r];
+        memcpy(porPosto + pos, ix->normalizados + ix->offNorm[i], ix->tamNormalizado[i] + 1);
+        ix->offNorm[i] = ix->offPosto[r] = pos;
+        pos += ix->tamNormalizado[i] + 1;
+    }
+    ix->offPosto[ix->numNomes] = pos;
+    free(ix->normalizados);
+    ix->normalizados = porPosto;
+    ix->capNorm = ix->tamNorm;
+    for (uint32_t r = 0; r < ix->numNomes; ++r) {
+        uint32_t i = ix->idDoPosto[r];
+        const char *norm = ix->normalizados + ix->offNorm[i];
+        size_t tam = ix->tamNormalizado[i];
+        ix->assinatura[r] = suspeitosAssinatura(norm, tam);
+        for (size_t k = 0; k < suspeitosNumTrigramas(tam); ++k) {
+            uint32_t j = suspeitosPosicao(ix, suspeitosTrigrama(norm, tam, k));
+            ix->postagens[ix->inicio[j] + ix->contagem[j]++] = r;
+        }
+    }
+    if (ix->numNomes >= SUSPEITOS_VIZ_MIN_NOMES && suspeitosConstroiVizinhanca(ix) != 0) return -1;
+
+    free(ix->marca);
+    free(ix->candidatos);
+    ix->marca = (uint8_t*) calloc(ix->numNomes ? ix->numNomes : 1, 1);
+    ix->candidatos = (uint32_t*) malloc(((size_t) ix->numNomes + 1) * sizeof(uint32_t));   // +1: escrita sem desvio
+    if (!ix->marca || !ix->candidatos) {
+        fprintf(stderr, "Erro: sem memória no índice de suspeitos.\n");
+        exit(EXIT_FAILURE);
+    }
+    ix->construido = 1;
+    return 0;
+}
+
+// -----------------------------
+// distanciaEdicao()
+// Levenshtein entre 'padrao' (m bytes) e 'texto' (n bytes).
+// Para m <= 64 usa o algoritmo bit-paralelo de Myers (variante global de
+// Hyyrö): uma coluna inteira da matriz é atualizada com poucas operações
+// sobre palavras de 64 bits. 'limite' permite abandonar cedo: se o
+// resultado com certeza passar de 'limite', retorna limite + 1.
+// A busca prepara a tabela de ocorrências da consulta uma única vez
+// (suspeitosPreparaPadrao) e a reaproveita em todos os candidatos.
+// -----------------------------
+static inline void suspeitosPreparaPadrao(const char *padrao, size_t m, uint64_t peq[256]) {
+    memset(peq, 0, 256 * sizeof(uint64_t));
+    for (size_t i = 0; i < m; ++i) peq[(unsigned char) padrao[i]] |= 1ULL << i;
+}
+
+// Myers/Hyyrö com a tabela já preparada (1 <= m <= 64)
+static inline int suspeitosMyers(const uint64_t peq[256], size_t m, const char *texto, size_t n, int limite) {
+    if (n == 0) return (int) m;
+    uint64_t pv = ~0ULL, mv = 0;
+    uint64_t ultimo = 1ULL << (m - 1);
+    int pontuacao = (int) m;
+    for (size_t j = 0; j < n; ++j) {
+        uint64_t eq = peq[(unsigned char) texto[j]];
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        if (ph & ultimo) pontuacao++;
+        else if (mh & ultimo) pontuacao--;
+        ph = (ph << 1) | 1;   // linha 0 cresce 1 por coluna (distância global)
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+        // cada coluna restante reduz no máximo 1
+        if (pontuacao - (int)(n - j - 1) > limite) return limite + 1;
+    }
+    return pontuacao;
+}
+
+static inline int distanciaEdicao(const char *padrao, size_t m, const char *texto, size_t n, int limite) {
+    if (m == 0) return (int) n;
+    if (n == 0) return (int) m;
+
+    if (m <= 64) {
+        uint64_t peq[256];
+        suspeitosPreparaPadrao(padrao, m, peq);
+        return suspeitosMyers(peq, m, texto, n, limite);
+    }
+
+    // padrão longo: programação dinâmica com duas linhas
+    int *ant = (int*) suspeitosRealloc(NULL, (n + 1) * sizeof(int));
+    int *cur = (int*) suspeitosRealloc(NULL, (n + 1) * sizeof(int));
+    for (size_t j = 0; j <= n; ++j) ant[j] = (int) j;
+    for (size_t i = 1; i <= m; ++i) {
+        cur[0] = (int) i;
+        for (size_t j = 1; j <= n; ++j) {
+            int custo = padrao[i - 1] == texto[j - 1] ? 0 : 1;
+            int v = ant[j - 1] + custo;
+            if (ant[j] + 1 < v) v = ant[j] + 1;
+            if (cur[j - 1] + 1 < v) v = cur[j - 1] + 1;
+            cur[j] = v;
+        }
+        int *t = ant; ant = cur; cur = t;
+    }
+    int d = ant[n];
+    free(ant);
+    free(cur);
+    return d;
+}
+
+// primeira posição de 'lista' (postos crescentes) com tamanho normalizado >= 'tam'
+static inline uint32_t suspeitosCorte(const IndiceSuspeitos *ix, const uint32_t *lista, uint32_t n, long tam) {
+    if (tam < 0) tam = 0;
+    if (tam > SUSPEITOS_MAX_CONSULTA + 1) tam = SUSPEITOS_MAX_CONSULTA + 1;
+    uint32_t posto = ix->inicioTamanho[tam];
+    uint32_t lo = 0, hi = n;
+    while (lo < hi) {
+        uint32_t meio = lo + (hi - lo) / 2;
+        if (lista[meio] < posto) lo = meio + 1;
+        else hi = meio;
+    }
+    return lo;
+}
+
+// -----------------------------
+// indiceSuspeitosBuscar()
+// Procura os nomes a distância <= maxDistancia da consulta (após
+// normalização). Preenche até 'maxResultados' resultados, do mais próximo
+// para o mais distante (empate: ordem de inserção) e retorna quantos foram
+// preenchidos.
+// -----------------------------
+static inline void suspeitosGuardaResultado(ResultadoSuspeito *res, int *num, int max, ResultadoSuspeito r) {
+    // inserção ordenada em um vetor pequeno (top-k)
+    int i;
+    if (*num < max) {
+        i = (*num)++;
+    } else {
+        const ResultadoSuspeito *ultimo = &res[max - 1];   // cheio: só entra se for melhor
+        if (ultimo->distancia < r.distancia ||
+            (ultimo->distancia == r.distancia && ultimo->indice < r.indice)) return;
+        i = max - 1;
+    }
+    while (i > 0 && (res[i - 1].distancia > r.distancia ||
+                     (res[i - 1].distancia == r.distancia && res[i - 1].indice > r.indice))) {
+        res[i] = res[i - 1];
+        i--;
+    }
+    res[i] = r;
+}
+
+static inline int indiceSuspeitosBuscar(IndiceSuspeitos *ix, const char *consulta, int maxDistancia,
+                                        ResultadoSuspeito *res, int maxResultados) {
+    if (!ix->construido || !consulta || maxResultados <= 0 || ix->numNomes == 0) return 0;
+    char q[SUSPEITOS_MAX_CONSULTA];
+    size_t m = suspeitosNormaliza(consulta, q, sizeof(q));
+    int num = 0;
+    uint64_t peq[256];
+    int bitParalelo = m >= 1 && m <= 64;
+    if (bitParalelo) suspeitosPreparaPadrao(q, m, peq);
+
+    // verifica um candidato pelo posto (assinatura, tamanho e Myers)
+    uint32_t assinatura = suspeitosAssinatura(q, m);
+    #define SUSPEITOS_VERIFICA(posto) do {                                                \
+        int limite = num == maxResultados ? res[num - 1].distancia : maxDistancia;        \
+        uint32_t a_ = ix->assinatura[posto];                                              \
+        uint32_t o_, n_;                                                                  \
+        int dif;                                                                          \
+        if (suspeitosBits(a_ & ~assinatura) > limite || suspeitosBits(assinatura & ~a_) > limite) break; \
+        o_ = ix->offPosto[posto];                                                         \
+        n_ = ix->offPosto[posto + 1] - o_ - 1;                                            \
+        dif = (int) n_ - (int) m;                                                         \
+        if (dif <= limite && -dif <= limite) {                                            \
+            const char *texto_ = ix->normalizados + o_;                                   \
+            int d = bitParalelo                                                           \
+                ? suspeitosMyers(peq, m, texto_, n_, limite)                              \
+                : distanciaEdicao(q, m, texto_, n_, limite);                              \
+            if (d <= limite) {                                                            \
+                uint32_t id_ = ix->idDoPosto[posto];                                      \
+                ResultadoSuspeito r_ = { ix->nomes + ix->offNome[id_], id_, d };          \
+                suspeitosGuardaResultado(res, &num, maxResultados, r_);                  \
+            }                                                                             \
+        }                                                                                 \
+    } while (0)
+
+    size_t numGramas = suspeitosNumTrigramas(m);
+    size_t estragados = (size_t) SUSPEITOS_Q * (size_t) maxDistancia;
+    uint32_t numCandidatos = 0;
+
+    int curta = m <= estragados + 2 && maxDistancia <= SUSPEITOS_VIZ_K;
+    if (curta && ix->vizDiretorio) {
+        // consulta curta: formas da consulta na vizinhança de remoções
+        uint32_t formas[SUSPEITOS_VIZ_MAX_FORMAS];
+        size_t f = suspeitosFormas(q, m, maxDistancia, formas);
+        for (size_t a = 0; a < f; ++a) {
+            uint32_t lo = ix->vizDiretorio[formas[a] >> 16], hi = ix->vizDiretorio[(formas[a] >> 16) + 1];
+            while (lo < hi) {
+                uint32_t meio = lo + (hi - lo) / 2;
+                if (ix->vizResumos[meio] < formas[a]) lo = meio + 1;
+                else hi = meio;
+            }
+            if (lo == ix->vizDiretorio[(formas[a] >> 16) + 1] || ix->vizResumos[lo] != formas[a]) continue;
+            for (uint32_t p = ix->vizInicio[lo]; p < ix->vizInicio[lo + 1]; ++p) {
+                uint32_t posto = ix->vizIds[p];
+                if (ix->marca[posto]) continue;   // já visto por outra forma
+                ix->marca[posto] = 1;
+                ix->candidatos[numCandidatos++] = posto;
+                SUSPEITOS_VERIFICA(posto);
+            }
+        }
+    } else if (curta || numGramas <= estragados) {
+        // curta sem vizinhança (poucos nomes), ou curta demais para o filtro
+        // e além da vizinhança indexada: varre todos
+        for (uint32_t r = 0; r < ix->numNomes; ++r) SUSPEITOS_VERIFICA(r);
+    } else {
+        // escolhe os 'usados' trigramas mais raros (seleção simples: poucos trigramas)
+        size_t usados = estragados + 1 + SUSPEITOS_FOLGA;
+        if (usados > numGramas) usados = numGramas;
+        uint32_t minimo = (uint32_t)(usados - estragados);
+        // (raridade medida só na faixa de tamanhos compatíveis de cada lista)
+        uint32_t de[SUSPEITOS_MAX_CONSULTA + SUSPEITOS_Q];
+        uint32_t freq[SUSPEITOS_MAX_CONSULTA + SUSPEITOS_Q];
+        for (size_t k = 0; k < numGramas; ++k) {
+            uint32_t j = suspeitosPosicao(ix, suspeitosTrigrama(q, m, k));
+            de[k] = freq[k] = 0;
+            if (ix->chaves[j] == 0) continue;
+            const uint32_t *lista = ix->postagens + ix->inicio[j];
+            uint32_t a = suspeitosCorte(ix, lista, ix->contagem[j], (long) m - maxDistancia);
+            uint32_t b = suspeitosCorte(ix, lista, ix->contagem[j], (long) m + maxDistancia + 1);
+            de[k] = ix->inicio[j] + a;
+            freq[k] = b - a;
+        }
+        for (size_t a = 0; a < usados; ++a) {
+            size_t menor = a;
+            for (size_t b = a + 1; b < numGramas; ++b) if (freq[b] < freq[menor]) menor = b;
+            uint32_t td = de[a]; de[a] = de[menor]; de[menor] = td;
+            uint32_t tf = freq[a]; freq[a] = freq[menor]; freq[menor] = tf;
+        }
+        // conta em quantas listas cada nome aparece (um trigrama repetido na
+        // consulta conta suas ocorrências mais de uma vez, o que só aumenta a
+        // contagem: nenhum nome válido é perdido). Quem não está em nenhuma das
+        // 'geradoras' listas mais raras chega no máximo a minimo - 1.
+        size_t geradoras = usados - minimo + 1;
+        size_t a = 0;
+        for (; a < geradoras; ++a) {
+            const uint32_t *lista = ix->postagens + de[a];
+            for (uint32_t k = 0; k < freq[a]; ++k) {
+                uint32_t posto = lista[k];
+                uint8_t v = ix->marca[posto];
+                // sem desvios: se o posto é novo ele entra na lista, senão a
+                // posição é sobrescrita pelo próximo
+                ix->candidatos[numCandidatos] = posto;
+                numCandidatos += v == 0;
+                ix->marca[posto] = (uint8_t)(v + (v < 0xFF));
+            }
+        }
+        // listas restantes (as mais longas): só somam para quem já é candidato,
+        // e só valem a pena enquanto custam menos que confirmar os candidatos
+        for (; a < usados && freq[a] <= (uint64_t) numCandidatos * SUSPEITOS_CUSTO_VERIFICA; ++a) {
+            const uint32_t *lista = ix->postagens + de[a];
+            for (uint32_t k = 0; k < freq[a]; ++k) {
+                uint32_t posto = lista[k];
+                uint8_t v = ix->marca[posto];
+                ix->marca[posto] = (uint8_t)(v + (v != 0 && v < 0xFF));
+            }
+        }
+        // cada lista não percorrida pode ter dado mais 1 a qualquer candidato
+        uint32_t naoPercorridas = (uint32_t)(usados - a);
+        uint32_t necessario = minimo > naoPercorridas ? minimo - naoPercorridas : 1;
+        for (uint32_t c = 0; c < numCandidatos; ++c) {
+            uint32_t posto = ix->candidatos[c];
+            if (ix->marca[posto] >= necessario) SUSPEITOS_VERIFICA(posto);
+        }
+    }
+    for (uint32_t c = 0; c < numCandidatos; ++c) ix->marca[ix->candidatos[c]] = 0;
+    #undef SUSPEITOS_VERIFICA
+    return num;
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef CASO_H
+#define CASO_H
+
+#include <stdint.h>
+#include <string.h>
+
+// -----------------------------
+// caso.h
+// Representação compacta e somente leitura de um caso (mansão + pistas + suspeitos).
+// As tabelas podem ser geradas em tempo de compilação por gerador_caso.c
+// (ver caso_mansao.h) ou montadas em tempo de execução por caso_construtor.h.
+// Todos os textos ficam internados em um único bloco ('textos') e as
+// estruturas guardam apenas deslocamentos e índices.
+// -----------------------------
+
+#define CASO_NENHUM 0xFFFFFFFFu   // índice/deslocamento ausente
+
+// Sala do mapa: nome, pista opcional e índices dos filhos na tabela de salas
+typedef struct CasoSala {
+    uint32_t nome;       // deslocamento em 'textos'
+    uint32_t pista;      // deslocamento em 'textos' (CASO_NENHUM se não houver)
+    uint32_t esquerda;   // índice da sala à esquerda (CASO_NENHUM se não houver)
+    uint32_t direita;    // índice da sala à direita (CASO_NENHUM se não houver)
+} CasoSala;
+
+// Posição da hash perfeita: pista (chave) -> índice do suspeito (valor)
+typedef struct CasoPista {
+    uint32_t pista;      // deslocamento em 'textos'
+    uint32_t suspeito;   // índice em 'suspeitos'
+} CasoPista;
+
+// Caso completo. A sala de índice 0 é a entrada da mansão.
+typedef struct Caso {
+    const char *textos;              // textos internados, separados por '\0'
+    const CasoSala *salas;
+    uint32_t numSalas;
+    const uint32_t *suspeitos;       // deslocamentos dos nomes dos suspeitos
+    uint32_t numSuspeitos;
+    const uint32_t *deslocamentos;   // semente da hash de 2º nível por balde
+    uint32_t numBaldes;
+    const CasoPista *pistas;         // uma posição por pista (hash perfeita mínima)
+    uint32_t numPistas;
+} Caso;
+
+// -----------------------------
+// casoHash()
+// FNV-1a com semente seguido de mistura final (fmix32 do MurmurHash3).
+// Usada tanto pelo gerador quanto pela consulta; não pode mudar sem
+// regenerar os casos estáticos.
+// -----------------------------
+static inline uint32_t casoHash(const char *s, uint32_t semente) {
+    uint32_t h = 2166136261u ^ semente;
+    int c;
+    while ((c = (unsigned char)*s++) != 0) {
+        h ^= (uint32_t)c;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+// casoTexto: retorna o texto de um deslocamento (NULL se CASO_NENHUM)
+static inline const char *casoTexto(const Caso *c, uint32_t desloc) {
+    return desloc == CASO_NENHUM ? NULL : c->textos + desloc;
+}
+
+// -----------------------------
+// casoEncontrarSuspeito()
+// Consulta a hash perfeita: um balde, uma semente, uma posição e uma única
+// comparação para confirmar a chave. Não há tratamento de colisões.
+// Retorna NULL se a pista não estiver associada a nenhum suspeito.
+// -----------------------------
+static inline const char *casoEncontrarSuspeito(const Caso *c, const char *pista) {
+    if (!c || !pista || c->numPistas == 0) return NULL;
+    uint32_t balde = casoHash(pista, 0) % c->numBaldes;
+    uint32_t pos = casoHash(pista, c->deslocamentos[balde]) % c->numPistas;
+    const CasoPista *p = &c->pistas[pos];
+    if (strcmp(c->textos + p->pista, pista) != 0) return NULL;
+    return c->textos + c->suspeitos[p->suspeito];
+}
+
+#endif
@@ -0,0 +1,522 @@
+#ifndef CASO_CONSTRUTOR_H
+#define CASO_CONSTRUTOR_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "caso.h"
+
+// -----------------------------
+// caso_construtor.h
+// Lê a descrição textual de um caso e monta as tabelas de caso.h:
+// textos internados, salas com índices dos filhos, suspeitos e a hash
+// perfeita mínima pista -> suspeito (hash-and-displace).
+//
+// Formato da descrição (uma diretiva por linha, campos separados por ';',
+// linhas vazias ou iniciadas por '#' são ignoradas):
+//   sala <id> ; <nome> [; <pista>]
+//   ligacao <id pai> ; <id esquerda ou -> ; <id direita ou ->
+//   suspeito <pista> ; <nome do suspeito>
+// A primeira sala declarada é a entrada da mansão. O mapa precisa ser uma
+// árvore: cada sala tem no máximo uma 'ligacao', é filha de no máximo uma
+// sala, a entrada não é filha de ninguém e não há ciclos. Uma pista repetida
+// em 'suspeito' sobrescreve a associação anterior.
+// -----------------------------
+
+#define CONSTRUTOR_MAX_LINHA 1024
+
+// entrada da hash de textos internados: além do deslocamento, lembra se o
+// texto já é um suspeito ou uma pista associada (evita buscas lineares)
+typedef struct ConstrutorInterno {
+    uint32_t texto;              // deslocamento em 'textos' (CASO_NENHUM = vazio)
+    uint32_t suspeito;           // índice em 'suspeitos' ou CASO_NENHUM
+    uint32_t pista;              // índice em 'pistas' ou CASO_NENHUM
+} ConstrutorInterno;
+
+typedef struct CasoConstrutor {
+    // textos internados
+    char *textos;
+    uint32_t tamTextos, capTextos;
+    ConstrutorInterno *internos; // hash aberta
+    uint32_t capInternos, numInternos;
+
+    // salas e seus identificadores (usados apenas nas ligações)
+    CasoSala *salas;
+    char **ids;
+    uint32_t numSalas, capSalas;
+    uint32_t *indiceIds;         // hash aberta de índices de sala (CASO_NENHUM = vazio)
+    uint32_t capIndiceIds;
+    uint32_t *pais;              // pai de cada sala (CASO_NENHUM = ainda sem pai)
+    uint32_t *grupos;            // união-busca: salas ligadas entre si têm a mesma raiz
+    unsigned char *ligadas;      // 1 se a sala já teve sua 'ligacao'
+
+    // suspeitos (deslocamentos em 'textos')
+    uint32_t *suspeitos;
+    uint32_t numSuspeitos, capSuspeitos;
+
+    // associações pista -> suspeito (antes e depois da hash perfeita)
+    CasoPista *pistas;
+    uint32_t numPistas, capPistas;
+    uint32_t *deslocamentos;
+    uint32_t numBaldes;
+} CasoConstrutor;
+
+// -----------------------------
+// Utilitários de memória (mesma política dos programas: falta de memória encerra)
+// -----------------------------
+static inline void *construtorRealloc(void *p, size_t n) {
+    void *r = realloc(p, n ? n : 1);
+    if (!r) {
+        fprintf(stderr, "Erro: sem memória ao montar o caso.\n");
+        exit(EXIT_FAILURE);
+    }
+    return r;
+}
+
+static inline void construtorInicializa(CasoConstrutor *b) {
+    memset(b, 0, sizeof(*b));
+}
+
+static inline void construtorLiberar(CasoConstrutor *b) {
+    for (uint32_t i = 0; i < b->numSalas; ++i) free(b->ids[i]);
+    free(b->textos);
+    free(b->internos);
+    free(b->salas);
+    free(b->ids);
+    free(b->indiceIds);
+    free(b->pais);
+    free(b->grupos);
+    free(b->ligadas);
+    free(b->suspeitos);
+    free(b->pistas);
+    free(b->deslocamentos);
+    construtorInicializa(b);
+}
+
+// -----------------------------
+// construtorInternar()
+// Retorna o deslocamento do texto no bloco internado, copiando-o apenas
+// na primeira ocorrência. construtorInterno() devolve a entrada da hash,
+// válida até a próxima inserção.
+// -----------------------------
+static inline void construtorCresceInternos(CasoConstrutor *b) {
+    uint32_t novaCap = b->capInternos ? b->capInternos * 2 : 64;
+    ConstrutorInterno *novo = (ConstrutorInterno*) construtorRealloc(NULL, novaCap * sizeof(ConstrutorInterno));
+    for (uint32_t i = 0; i < novaCap; ++i) novo[i].texto = CASO_NENHUM;
+    for (uint32_t i = 0; i < b->capInternos; ++i) {
+        if (b->internos[i].texto == CASO_NENHUM) continue;
+        uint32_t j = casoHash(b->textos + b->internos[i].texto, 0) & (novaCap - 1);
+        while (novo[j].texto != CASO_NENHUM) j = (j + 1) & (novaCap - 1);
+        novo[j] = b->internos[i];
+    }
+    free(b->internos);
+    b->internos = novo;
+    b->capInternos = novaCap;
+}
+
+static inline ConstrutorInterno *construtorInterno(CasoConstrutor *b, const char *s) {
+    if ((b->numInternos + 1) * 10 > b->capInternos * 7) construtorCresceInternos(b);
+    uint32_t j = casoHash(s, 0) & (b->capInternos - 1);
+    while (b->internos[j].texto != CASO_NENHUM) {
+        if (strcmp(b->textos + b->internos[j].texto, s) == 0) return &b->internos[j];
+        j = (j + 1) & (b->capInternos - 1);
+    }
+    uint32_t n = (uint32_t) strlen(s) + 1;
+    if (b->tamTextos + n > b->capTextos) {
+        uint32_t novaCap = b->capTextos ? b->capTextos : 256;
+        while (b->tamTextos + n > novaCap) novaCap *= 2;
+        b->textos = (char*) construtorRealloc(b->textos, novaCap);
+        b->capTextos = novaCap;
+    }
+    uint32_t off = b->tamTextos;
+    memcpy(b->textos + off, s, n);
+    b->tamTextos += n;
+    b->internos[j].texto = off;
+    b->internos[j].suspeito = b->internos[j].pista = CASO_NENHUM;
+    b->numInternos++;
+    return &b->internos[j];
+}
+
+static inline uint32_t construtorInternar(CasoConstrutor *b, const char *s) {
+    return construtorInterno(b, s)->texto;
+}
+
+// -----------------------------
+// Inserções (API usada pelo leitor e por quem monta casos em código)
+// -----------------------------
+
+// posição do id na hash de salas: a que o contém ou a vaga onde entraria
+static inline uint32_t construtorPosicaoId(const CasoConstrutor *b, const char *id) {
+    uint32_t j = casoHash(id, 0) & (b->capIndiceIds - 1);
+    while (b->indiceIds[j] != CASO_NENHUM && strcmp(b->ids[b->indiceIds[j]], id) != 0)
+        j = (j + 1) & (b->capIndiceIds - 1);
+    return j;
+}
+
+// procura sala pelo identificador; retorna CASO_NENHUM se não existir
+static inline uint32_t construtorBuscaSala(const CasoConstrutor *b, const char *id) {
+    if (b->capIndiceIds == 0) return CASO_NENHUM;
+    return b->indiceIds[construtorPosicaoId(b, id)];
+}
+
+static inline void construtorCresceIndiceIds(CasoConstrutor *b) {
+    free(b->indiceIds);
+    b->capIndiceIds = b->capIndiceIds ? b->capIndiceIds * 2 : 32;
+    b->indiceIds = (uint32_t*) construtorRealloc(NULL, b->capIndiceIds * sizeof(uint32_t));
+    for (uint32_t i = 0; i < b->capIndiceIds; ++i) b->indiceIds[i] = CASO_NENHUM;
+    for (uint32_t i = 0; i < b->numSalas; ++i) b->indiceIds[construtorPosicaoId(b, b->ids[i])] = i;
+}
+
+// construtorAdicionarSala: retorna o índice da nova sala (CASO_NENHUM se o id repetir)
+static inline uint32_t construtorAdicionarSala(CasoConstrutor *b, const char *id, const char *nome, const char *pista) {
+    if (construtorBuscaSala(b, id) != CASO_NENHUM) return CASO_NENHUM;
+    if ((b->numSalas + 1) * 10 > b->capIndiceIds * 7) construtorCresceIndiceIds(b);
+    if (b->numSalas == b->capSalas) {
+        b->capSalas = b->capSalas ? b->capSalas * 2 : 16;
+        b->salas = (CasoSala*) construtorRealloc(b->salas, b->capSalas * sizeof(CasoSala));
+        b->ids = (char**) construtorRealloc(b->ids, b->capSalas * sizeof(char*));
+        b->pais = (uint32_t*) construtorRealloc(b->pais, b->capSalas * sizeof(uint32_t));
+        b->grupos = (uint32_t*) construtorRealloc(b->grupos, b->capSalas * sizeof(uint32_t));
+        b->ligadas = (unsigned char*) construtorRealloc(b->ligadas, b->capSalas);
+    }
+    size_t n = strlen(id) + 1;
+    char *copia = (char*) construtorRealloc(NULL, n);
+    memcpy(copia, id, n);
+
+    CasoSala *s = &b->salas[b->numSalas];
+    s->nome = construtorInternar(b, nome);
+    s->pista = (pista && *pista) ? construtorInternar(b, pista) : CASO_NENHUM;
+    s->esquerda = s->direita = CASO_NENHUM;
+    b->ids[b->numSalas] = copia;
+    b->pais[b->numSalas] = CASO_NENHUM;
+    b->grupos[b->numSalas] = b->numSalas;
+    b->ligadas[b->numSalas] = 0;
+    b->indiceIds[construtorPosicaoId(b, id)] = b->numSalas;
+    return b->numSalas++;
+}
+
+// raiz do grupo da sala (com compressão de caminho). Como cada sala tem no
+// máximo um pai, a raiz do grupo é o ancestral mais alto já ligado.
+static inline uint32_t construtorRaiz(CasoConstrutor *b, uint32_t sala) {
+    uint32_t r = sala;
+    while (b->grupos[r] != r) r = b->grupos[r];
+    while (b->grupos[sala] != r) {
+        uint32_t prox = b->grupos[sala];
+        b->grupos[sala] = r;
+        sala = prox;
+    }
+    return r;
+}
+
+// -----------------------------
+// construtorLigar()
+// Define os filhos da sala 'pai' (CASO_NENHUM = sem saída) mantendo o mapa
+// uma árvore. Retorna LIGACAO_OK ou o motivo da recusa; em 'culpada' fica a
+// sala que causou a recusa. Nada é alterado quando a ligação é recusada.
+// -----------------------------
+enum {
+    LIGACAO_OK = 0,
+    LIGACAO_REPETIDA,       // o pai já teve sua ligação
+    LIGACAO_ENTRADA,        // a entrada não pode ser filha
+    LIGACAO_OUTRO_PAI,      // o filho já tem pai (ou aparece duas vezes)
+    LIGACAO_CICLO           // o filho é o próprio pai ou um ancestral dele
+};
+
+static inline int construtorLigar(CasoConstrutor *b, uint32_t pai, uint32_t esquerda, uint32_t direita,
+                                  uint32_t *culpada) {
+    uint32_t filhos[2] = { esquerda, direita };
+    *culpada = pai;
+    if (b->ligadas[pai]) return LIGACAO_REPETIDA;
+    uint32_t raizPai = construtorRaiz(b, pai);
+    for (int i = 0; i < 2; ++i) {
+        uint32_t f = filhos[i];
+        if (f == CASO_NENHUM) continue;
+        *culpada = f;
+        if (f == 0) return LIGACAO_ENTRADA;
+        if (b->pais[f] != CASO_NENHUM || (i == 1 && f == esquerda)) return LIGACAO_OUTRO_PAI;
+        // sem pai, 'f' é a raiz do seu grupo: se o pai está nele, 'f' é ancestral do pai
+        if (raizPai == f) return LIGACAO_CICLO;
+    }
+    for (int i = 0; i < 2; ++i) {
+        if (filhos[i] == CASO_NENHUM) continue;
+        b->pais[filhos[i]] = pai;
+        b->grupos[filhos[i]] = raizPai;
+    }
+    b->salas[pai].esquerda = esquerda;
+    b->salas[pai].direita = direita;
+    b->ligadas[pai] = 1;
+    return LIGACAO_OK;
+}
+
+// construtorAssociar: registra pista -> suspeito (sobrescreve se a pista já existir).
+// Suspeito e pista já vistos são achados pela própria hash de textos.
+static inline void construtorAssociar(CasoConstrutor *b, const char *pista, const char *suspeito) {
+    ConstrutorInterno *s = construtorInterno(b, suspeito);
+    uint32_t idx = s->suspeito;
+    if (idx == CASO_NENHUM) {
+        if (b->numSuspeitos == b->capSuspeitos) {
+            b->capSuspeitos = b->capSuspeitos ? b->capSuspeitos * 2 : 8;
+            b->suspeitos = (uint32_t*) construtorRealloc(b->suspeitos, b->capSuspeitos * sizeof(uint32_t));
+        }
+        idx = s->suspeito = b->numSuspeitos;
+        b->suspeitos[b->numSuspeitos++] = s->texto;
+    }
+
+    ConstrutorInterno *p = construtorInterno(b, pista);   // pode rehashear: 's' não vale mais
+    if (p->pista != CASO_NENHUM) {
+        b->pistas[p->pista].suspeito = idx;
+        return;
+    }
+    if (b->numPistas == b->capPistas) {
+        b->capPistas = b->capPistas ? b->capPistas * 2 : 16;
+        b->pistas = (CasoPista*) construtorRealloc(b->pistas, b->capPistas * sizeof(CasoPista));
+    }
+    p->pista = b->numPistas;
+    b->pistas[b->numPistas].pista = p->texto;
+    b->pistas[b->numPistas].suspeito = idx;
+    b->numPistas++;
+}
+
+// -----------------------------
+// construtorLerArquivo()
+// Interpreta a descrição do caso. Retorna 0 em sucesso ou -1 com a
+// mensagem de erro (incluindo o número da linha) em 'erro'.
+// -----------------------------
+
+// remove espaços nas pontas (in-place) e retorna o início
+static inline char *construtorApara(char *s) {
+    while (isspace((unsigned char)*s)) s++;
+    size_t n = strlen(s);
+    while (n > 0 && isspace((unsigned char)s[n - 1])) s[--n] = '\0';
+    return s;
+}
+
+// separa até 'max' campos por ';' (in-place); retorna quantos encontrou
+static inline int construtorCampos(char *s, char **campos, int max) {
+    int n = 0;
+    while (n < max) {
+        char *fim = strchr(s, ';');
+        if (fim) *fim = '\0';
+        campos[n++] = construtorApara(s);
+        if (!fim) break;
+        s = fim + 1;
+    }
+    return n;
+}
+
+static inline int construtorLerArquivo(CasoConstrutor *b, FILE *f, char *erro, size_t tamErro) {
+    char linha[CONSTRUTOR_MAX_LINHA];
+    int numLinha = 0;
+
+    while (fgets(linha, sizeof(linha), f) != NULL) {
+        numLinha++;
+        char *s = construtorApara(linha);
+        if (*s == '\0' || *s == '#') continue;
+
+        char *resto = s;
+        while (*resto && !isspace((unsigned char)*resto)) resto++;
+        if (*resto) *resto++ = '\0';
+
+        char *campos[3];
+        int n = construtorCampos(resto, campos, 3);
+
+        if (strcmp(s, "sala") == 0) {
+            if (n < 2 || *campos[0] == '\0' || *campos[1] == '\0') {
+                snprintf(erro, tamErro, "linha %d: esperado 'sala <id> ; <nome> [; <pista>]'", numLinha);
+                return -1;
+            }
+            if (construtorAdicionarSala(b, campos[0], campos[1], n > 2 ? campos[2] : NULL) == CASO_NENHUM) {
+                snprintf(erro, tamErro, "linha %d: sala '%s' repetida", numLinha, campos[0]);
+                return -1;
+            }
+        } else if (strcmp(s, "ligacao") == 0) {
+            if (n != 3) {
+                snprintf(erro, tamErro, "linha %d: esperado 'ligacao <pai> ; <esquerda> ; <direita>'", numLinha);
+                return -1;
+            }
+            uint32_t idx[3];
+            for (int i = 0; i < 3; ++i) {
+                if (i > 0 && strcmp(campos[i], "-") == 0) {
+                    idx[i] = CASO_NENHUM;
+                    continue;
+                }
+                idx[i] = construtorBuscaSala(b, campos[i]);
+                if (idx[i] == CASO_NENHUM) {
+                    snprintf(erro, tamErro, "linha %d: sala '%s' não declarada", numLinha, campos[i]);
+                    return -1;
+                }
+            }
+            uint32_t culpada;
+            int r = construtorLigar(b, idx[0], idx[1], idx[2], &culpada);
+            if (r != LIGACAO_OK) {
+                const char *id = b->ids[culpada];
+                if (r == LIGACAO_REPETIDA)
+                    snprintf(erro, tamErro, "linha %d: sala '%s' já tem ligação", numLinha, id);
+                else if (r == LIGACAO_ENTRADA)
+                    snprintf(erro, tamErro, "linha %d: a entrada '%s' não pode ser filha de outra sala", numLinha, id);
+                else if (r == LIGACAO_OUTRO_PAI)
+                    snprintf(erro, tamErro, "linha %d: sala '%s' já é filha de outra sala", numLinha, id);
+                else
+                    snprintf(erro, tamErro, "linha %d: ligar '%s' a '%s' forma um ciclo", numLinha, campos[0], id);
+                return -1;
+            }
+        } else if (strcmp(s, "suspeito") == 0) {
+            if (n != 2 || *campos[0] == '\0' || *campos[1] == '\0') {
+                snprintf(erro, tamErro, "linha %d: esperado 'suspeito <pista> ; <suspeito>'", numLinha);
+                return -1;
+            }
+            construtorAssociar(b, campos[0], campos[1]);
+        } else {
+            snprintf(erro, tamErro, "linha %d: diretiva desconhecida '%s'", numLinha, s);
+            return -1;
+        }
+    }
+
+    if (b->numSalas == 0) {
+        snprintf(erro, tamErro, "caso sem salas");
+        return -1;
+    }
+    return 0;
+}
+
+// -----------------------------
+// construtorGerarHashPerfeita()
+// Hash-and-displace: cada pista cai em um balde por casoHash(p, 0); os
+// baldes são processados do maior para o menor e, para cada um, procura-se
+// a menor semente que leve todas as suas pistas a posições livres e
+// distintas. Reordena 'pistas' para a posição final de cada chave.
+// Retorna 0 em sucesso ou -1 se nenhuma semente servir (improvável).
+// -----------------------------
+#define CONSTRUTOR_MAX_SEMENTE (1u << 24)
+
+static inline int construtorGerarHashPerfeita(CasoConstrutor *b) {
+    uint32_t n = b->numPistas;
+    b->numBaldes = n / 2 + 1;
+    free(b->deslocamentos);
+    b->deslocamentos = (uint32_t*) construtorRealloc(NULL, b->numBaldes * sizeof(uint32_t));
+    memset(b->deslocamentos, 0, b->numBaldes * sizeof(uint32_t));
+    if (n == 0) return 0;
+
+    // agrupa pistas por balde (contagem + prefixos)
+    uint32_t *inicio = (uint32_t*) construtorRealloc(NULL, (b->numBaldes + 1) * sizeof(uint32_t));
+    uint32_t *membros = (uint32_t*) construtorRealloc(NULL, n * sizeof(uint32_t));
+    uint32_t *ordem = (uint32_t*) construtorRealloc(NULL, b->numBaldes * sizeof(uint32_t));
+    memset(inicio, 0, (b->numBaldes + 1) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < n; ++i)
+        inicio[casoHash(b->textos + b->pistas[i].pista, 0) % b->numBaldes + 1]++;
+    for (uint32_t i = 0; i < b->numBaldes; ++i) inicio[i + 1] += inicio[i];
+    {
+        uint32_t *pos = (uint32_t*) construtorRealloc(NULL, b->numBaldes * sizeof(uint32_t));
+        memcpy(pos, inicio, b->numBaldes * sizeof(uint32_t));
+        for (uint32_t i = 0; i < n; ++i)
+            membros[pos[casoHash(b->textos + b->pistas[i].pista, 0) % b->numBaldes]++] = i;
+        free(pos);
+    }
+
+    // baldes em ordem decrescente de tamanho (contagem por tamanho: estável e sem qsort_r)
+    uint32_t maior = 0;
+    for (uint32_t i = 0; i < b->numBaldes; ++i) {
+        uint32_t t = inicio[i + 1] - inicio[i];
+        if (t > maior) maior = t;
+    }
+    uint32_t k = 0;
+    for (uint32_t t = maior; t > 0; --t)
+        for (uint32_t i = 0; i < b->numBaldes; ++i)
+            if (inicio[i + 1] - inicio[i] == t) ordem[k++] = i;
+
+    CasoPista *final = (CasoPista*) construtorRealloc(NULL, n * sizeof(CasoPista));
+    unsigned char *ocupado = (unsigned char*) construtorRealloc(NULL, n);
+    uint32_t *tentativa = (uint32_t*) construtorRealloc(NULL, maior * sizeof(uint32_t));
+    memset(ocupado, 0, n);
+    int ok = 0;
+
+    for (uint32_t o = 0; o < k; ++o) {
+        uint32_t balde = ordem[o];
+        uint32_t tam = inicio[balde + 1] - inicio[balde];
+        ok = 0;
+        for (uint32_t semente = 1; semente < CONSTRUTOR_MAX_SEMENTE && !ok; ++semente) {
+            uint32_t j;
+            for (j = 0; j < tam; ++j) {
+                const char *p = b->textos + b->pistas[membros[inicio[balde] + j]].pista;
+                uint32_t pos = casoHash(p, semente) % n;
+                if (ocupado[pos]) break;
+                ocupado[pos] = 1;           // marca provisoriamente (detecta colisão interna)
+                tentativa[j] = pos;
+            }
+            if (j == tam) {
+                for (j = 0; j < tam; ++j) final[tentativa[j]] = b->pistas[membros[inicio[balde] + j]];
+                b->deslocamentos[balde] = semente;
+                ok = 1;
+            } else {
+                while (j-- > 0) ocupado[tentativa[j]] = 0;   // desfaz marcações
+            }
+        }
+        if (!ok) break;
+    }
+
+    if (ok) {
+        memcpy(b->pistas, final, n * sizeof(CasoPista));
+        // as pistas mudaram de posição: atualiza os índices guardados na hash de textos
+        for (uint32_t i = 0; i < n; ++i) construtorInterno(b, b->textos + b->pistas[i].pista)->pista = i;
+    }
+    free(final);
+    free(ocupado);
+    free(tentativa);
+    free(ordem);
+    free(membros);
+    free(inicio);
+    return ok ? 0 : -1;
+}
+
+// construtorComoCaso: visão caso.h das tabelas montadas (válida enquanto 'b' existir)
+static inline Caso construtorComoCaso(const CasoConstrutor *b) {
+    Caso c;
+    c.textos = b->textos;
+    c.salas = b->salas;
+    c.numSalas = b->numSalas;
+    c.suspeitos = b->suspeitos;
+    c.numSuspeitos = b->numSuspeitos;
+    c.deslocamentos = b->deslocamentos;
+    c.numBaldes = b->numBaldes;
+    c.pistas = b->pistas;
+    c.numPistas = b->numPistas;
+    return c;
+}
+
+// -----------------------------
+// construtorEmpacotar()
+// Copia as tabelas montadas para um único bloco alocado (Caso + tabelas +
+// textos), liberável com um só free(). Usado para casos carregados em
+// tempo de execução (ver catalogo_casos.h). Requer a hash perfeita já
+// gerada. Se 'tamanho' não for NULL, recebe o total de bytes do bloco.
+// -----------------------------
+// memcpy que aceita tabela vazia (origem NULL) e devolve o destino
+static inline void *construtorCopia(void *dst, const void *src, size_t n) {
+    if (n) memcpy(dst, src, n);
+    return dst;
+}
+
+static inline Caso *construtorEmpacotar(const CasoConstrutor *b, size_t *tamanho) {
+    size_t bSalas = (size_t) b->numSalas * sizeof(CasoSala);
+    size_t bSusp = (size_t) b->numSuspeitos * sizeof(uint32_t);
+    size_t bDesl = (size_t) b->numBaldes * sizeof(uint32_t);
+    size_t bPistas = (size_t) b->numPistas * sizeof(CasoPista);
+    size_t total = sizeof(Caso) + bSalas + bSusp + bDesl + bPistas + b->tamTextos;
+
+    // todas as tabelas têm alinhamento de 4 bytes; os textos vêm por último
+    char *bloco = (char*) construtorRealloc(NULL, total);
+    Caso *c = (Caso*) bloco;
+    char *p = bloco + sizeof(Caso);
+    *c = construtorComoCaso(b);
+    c->salas = (const CasoSala*) construtorCopia(p, b->salas, bSalas);                 p += bSalas;
+    c->suspeitos = (const uint32_t*) construtorCopia(p, b->suspeitos, bSusp);          p += bSusp;
+    c->deslocamentos = (const uint32_t*) construtorCopia(p, b->deslocamentos, bDesl);  p += bDesl;
+    c->pistas = (const CasoPista*) construtorCopia(p, b->pistas, bPistas);             p += bPistas;
+    c->textos = (const char*) construtorCopia(p, b->textos, b->tamTextos);
+
+    if (tamanho) *tamanho = total;
+    return c;
+}
+
+#endif
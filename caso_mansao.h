@@ -0,0 +1,64 @@
+// Gerado por gerador_caso.c a partir de casos/mansao.txt. NÃO EDITAR.
+#ifndef CASO_MANSAO_H
+#define CASO_MANSAO_H
+
+#include "caso.h"
+
+static const char CASO_MANSAO_TEXTOS[401] =
+    /*     0 */ "Hall de Entrada\0"
+    /*    16 */ "Bilhete rasgado com hora marcada\0"
+    /*    49 */ "Sala de Estar\0"
+    /*    63 */ "Pegadas molhadas perto da lareira\0"
+    /*    97 */ "Cozinha\0"
+    /*   105 */ "Faca com monograma X\0"
+    /*   126 */ "Biblioteca\0"
+    /*   137 */ "Livro apontando para passagem secreta\0"
+    /*   175 */ "Jardim\0"
+    /*   182 */ "Foto antiga da família com uma assinatura\0"
+    /*   225 */ "Porão\0"
+    /*   232 */ "Raspas de tinta da mesma cor da mansão\0"
+    /*   272 */ "Escritório\0"
+    /*   284 */ "Carta com assinatura parcial\0"
+    /*   313 */ "Sótão\0"
+    /*   321 */ "Chave enferrujada com iniciais 'M.'\0"
+    /*   357 */ "Suspeito A\0"
+    /*   368 */ "Suspeito B\0"
+    /*   379 */ "Suspeito C\0"
+    /*   390 */ "Suspeito D\0"
+;
+
+static const CasoSala CASO_MANSAO_SALAS[8] = {
+    { 0, 16, 1, 2 },   // 0: hall
+    { 49, 63, 3, 4 },   // 1: salaEstar
+    { 97, 105, 5, 6 },   // 2: cozinha
+    { 126, 137, 7, CASO_NENHUM },   // 3: biblioteca
+    { 175, 182, CASO_NENHUM, CASO_NENHUM },   // 4: jardim
+    { 225, 232, CASO_NENHUM, CASO_NENHUM },   // 5: porao
+    { 272, 284, CASO_NENHUM, CASO_NENHUM },   // 6: escritorio
+    { 313, 321, CASO_NENHUM, CASO_NENHUM },   // 7: sotao
+};
+
+static const uint32_t CASO_MANSAO_SUSPEITOS[4] = { 357, 368, 379, 390 };
+
+static const uint32_t CASO_MANSAO_DESLOCAMENTOS[5] = { 0, 2, 11, 1, 1 };
+
+static const CasoPista CASO_MANSAO_PISTAS[8] = {
+    { 232, 2 },
+    { 182, 1 },
+    { 137, 0 },
+    { 321, 3 },
+    { 105, 2 },
+    { 16, 0 },
+    { 284, 0 },
+    { 63, 1 },
+};
+
+static const Caso CASO_MANSAO = {
+    CASO_MANSAO_TEXTOS,
+    CASO_MANSAO_SALAS, 8,
+    CASO_MANSAO_SUSPEITOS, 4,
+    CASO_MANSAO_DESLOCAMENTOS, 5,
+    CASO_MANSAO_PISTAS, 8
+};
+
+#endif
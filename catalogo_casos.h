@@ -0,0 +1,263 @@
+#ifndef CATALOGO_CASOS_H
+#define CATALOGO_CASOS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "caso.h"
+#include "caso_construtor.h"
+
+// -----------------------------
+// catalogo_casos.h
+// Catálogo de casos carregados sob demanda, com cache LRU limitado por memória.
+//
+// - catalogoAbrir() devolve o caso pedido (carregando-o se preciso) e
+//   incrementa sua contagem de referências; catalogoFechar() a decrementa.
+// - Casos com referências (sessões ativas) nunca são despejados, mesmo que
+//   o orçamento seja ultrapassado.
+// - Casos sem referências ficam em uma lista LRU; enquanto os bytes em uso
+//   passarem do orçamento, os mais frios (fim da lista) são liberados.
+// - Métricas de acertos, faltas, despejos e falhas de carga ficam em
+//   catalogo->metricas.
+// -----------------------------
+
+#define CATALOGO_BALDES_INICIAIS 64
+
+// Função que carrega um caso pelo nome. Deve devolver um bloco único
+// liberável com free() (ver construtorEmpacotar) e seu tamanho em bytes,
+// ou NULL se o caso não existir.
+typedef Caso *(*CatalogoCarregador)(void *contexto, const char *nome, size_t *bytes);
+
+typedef struct CatalogoCaso {
+    char *nome;
+    Caso *caso;
+    size_t bytes;
+    int referencias;
+    struct CatalogoCaso *anterior;   // lista LRU (apenas casos sem referências)
+    struct CatalogoCaso *seguinte;
+    struct CatalogoCaso *prox;       // encadeamento no balde do índice
+} CatalogoCaso;
+
+typedef struct CatalogoMetricas {
+    unsigned long acertos;
+    unsigned long faltas;
+    unsigned long despejos;
+    unsigned long falhasCarga;
+} CatalogoMetricas;
+
+typedef struct Catalogo {
+    CatalogoCarregador carregar;
+    void *contexto;
+    size_t orcamento;          // bytes máximos dos casos carregados
+    size_t bytesEmUso;
+    CatalogoCaso **baldes;     // índice nome -> caso carregado
+    size_t numBaldes, numCasos;
+    CatalogoCaso *maisRecente; // cabeça da lista LRU
+    CatalogoCaso *menosRecente;
+    CatalogoMetricas metricas;
+} Catalogo;
+
+// -----------------------------
+// Lista LRU
+// -----------------------------
+static inline void catalogoRetiraLRU(Catalogo *cat, CatalogoCaso *e) {
+    if (e->anterior) e->anterior->seguinte = e->seguinte;
+    else cat->maisRecente = e->seguinte;
+    if (e->seguinte) e->seguinte->anterior = e->anterior;
+    else cat->menosRecente = e->anterior;
+    e->anterior = e->seguinte = NULL;
+}
+
+static inline void catalogoInsereLRU(Catalogo *cat, CatalogoCaso *e) {
+    e->anterior = NULL;
+    e->seguinte = cat->maisRecente;
+    if (cat->maisRecente) cat->maisRecente->anterior = e;
+    else cat->menosRecente = e;
+    cat->maisRecente = e;
+}
+
+// -----------------------------
+// Índice por nome (tabela hash com encadeamento)
+// -----------------------------
+static inline CatalogoCaso **catalogoBalde(const Catalogo *cat, const char *nome) {
+    return &cat->baldes[casoHash(nome, 0) & (cat->numBaldes - 1)];
+}
+
+static inline void catalogoCresceIndice(Catalogo *cat) {
+    size_t antigo = cat->numBaldes;
+    CatalogoCaso **velhos = cat->baldes;
+    cat->numBaldes *= 2;
+    cat->baldes = (CatalogoCaso**) calloc(cat->numBaldes, sizeof(CatalogoCaso*));
+    if (!cat->baldes) {
+        fprintf(stderr, "Erro ao alocar índice do catálogo.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < antigo; ++i) {
+        CatalogoCaso *e = velhos[i];
+        while (e) {
+            CatalogoCaso *prox = e->prox;
+            CatalogoCaso **b = catalogoBalde(cat, e->nome);
+            e->prox = *b;
+            *b = e;
+            e = prox;
+        }
+    }
+    free(velhos);
+}
+
+// remove do índice e libera o caso (não pode ter referências)
+static inline void catalogoDescarta(Catalogo *cat, CatalogoCaso *e) {
+    CatalogoCaso **p = catalogoBalde(cat, e->nome);
+    while (*p != e) p = &(*p)->prox;
+    *p = e->prox;
+    cat->bytesEmUso -= e->bytes;
+    cat->numCasos--;
+    free(e->caso);
+    free(e->nome);
+    free(e);
+}
+
+// despeja casos frios até respeitar o orçamento (ou acabar a lista LRU)
+static inline void catalogoAjustaOrcamento(Catalogo *cat) {
+    while (cat->bytesEmUso > cat->orcamento && cat->menosRecente) {
+        CatalogoCaso *frio = cat->menosRecente;
+        catalogoRetiraLRU(cat, frio);
+        catalogoDescarta(cat, frio);
+        cat->metricas.despejos++;
+    }
+}
+
+// -----------------------------
+// catalogoInicializar()
+// Prepara um catálogo vazio com orçamento de memória (bytes) e carregador.
+// -----------------------------
+static inline void catalogoInicializar(Catalogo *cat, size_t orcamento, CatalogoCarregador carregar, void *contexto) {
+    memset(cat, 0, sizeof(*cat));
+    cat->carregar = carregar;
+    cat->contexto = contexto;
+    cat->orcamento = orcamento;
+    cat->numBaldes = CATALOGO_BALDES_INICIAIS;
+    cat->baldes = (CatalogoCaso**) calloc(cat->numBaldes, sizeof(CatalogoCaso*));
+    if (!cat->baldes) {
+        fprintf(stderr, "Erro ao alocar índice do catálogo.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// -----------------------------
+// catalogoAbrir()
+// Devolve o caso 'nome' com uma referência a mais (NULL se não puder ser
+// carregado). O ponteiro vale até o catalogoFechar() correspondente.
+// -----------------------------
+static inline CatalogoCaso *catalogoAbrir(Catalogo *cat, const char *nome) {
+    if (!nome) return NULL;
+    CatalogoCaso *e = *catalogoBalde(cat, nome);
+    while (e && strcmp(e->nome, nome) != 0) e = e->prox;
+
+    if (e) {
+        cat->metricas.acertos++;
+        if (e->referencias == 0) catalogoRetiraLRU(cat, e);   // volta a ficar fixo
+        e->referencias++;
+        return e;
+    }
+
+    cat->metricas.faltas++;
+    size_t bytes = 0;
+    Caso *caso = cat->carregar(cat->contexto, nome, &bytes);
+    if (!caso) {
+        cat->metricas.falhasCarga++;
+        return NULL;
+    }
+
+    e = (CatalogoCaso*) calloc(1, sizeof(CatalogoCaso));
+    size_t n = strlen(nome) + 1;
+    char *copia = (char*) malloc(n);
+    if (!e || !copia) {
+        fprintf(stderr, "Erro ao alocar entrada do catálogo.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(copia, nome, n);
+    e->nome = copia;
+    e->caso = caso;
+    e->bytes = bytes + sizeof(CatalogoCaso) + n;
+    e->referencias = 1;
+
+    if ((cat->numCasos + 1) * 4 > cat->numBaldes * 3) catalogoCresceIndice(cat);
+    CatalogoCaso **b = catalogoBalde(cat, nome);
+    e->prox = *b;
+    *b = e;
+    cat->numCasos++;
+    cat->bytesEmUso += e->bytes;
+
+    catalogoAjustaOrcamento(cat);
+    return e;
+}
+
+// -----------------------------
+// catalogoFechar()
+// Solta uma referência. Sem referências, o caso passa a ser o mais recente
+// da lista LRU e pode ser despejado se o orçamento estiver estourado.
+// -----------------------------
+static inline void catalogoFechar(Catalogo *cat, CatalogoCaso *e) {
+    if (!e || e->referencias <= 0) return;
+    if (--e->referencias == 0) {
+        catalogoInsereLRU(cat, e);
+        catalogoAjustaOrcamento(cat);
+    }
+}
+
+// -----------------------------
+// catalogoLiberar()
+// Libera todos os casos (inclusive os ainda referenciados) e o índice.
+// -----------------------------
+static inline void catalogoLiberar(Catalogo *cat) {
+    for (size_t i = 0; i < cat->numBaldes; ++i) {
+        CatalogoCaso *e = cat->baldes[i];
+        while (e) {
+            CatalogoCaso *prox = e->prox;
+            free(e->caso);
+            free(e->nome);
+            free(e);
+            e = prox;
+        }
+    }
+    free(cat->baldes);
+    memset(cat, 0, sizeof(*cat));
+}
+
+// -----------------------------
+// catalogoCarregadorArquivos()
+// Carregador padrão: lê <contexto>/<nome>.txt no formato de caso_construtor.h.
+// 'contexto' é o diretório dos casos (const char*). Nomes que sairiam do
+// diretório ('/', '\\', "..") ou que não cabem no caminho são recusados.
+// -----------------------------
+static inline int catalogoNomeValido(const char *nome) {
+    return *nome != '\0' && !strchr(nome, '/') && !strchr(nome, '\\') && !strstr(nome, "..");
+}
+
+static inline Caso *catalogoCarregadorArquivos(void *contexto, const char *nome, size_t *bytes) {
+    char caminho[512];
+    if (!catalogoNomeValido(nome)) return NULL;
+    int n = snprintf(caminho, sizeof(caminho), "%s/%s.txt", (const char*) contexto, nome);
+    if (n < 0 || (size_t) n >= sizeof(caminho)) return NULL;
+    FILE *f = fopen(caminho, "r");
+    if (!f) return NULL;
+
+    CasoConstrutor b;
+    construtorInicializa(&b);
+    char erro[256];
+    Caso *caso = NULL;
+    if (construtorLerArquivo(&b, f, erro, sizeof(erro)) != 0) {
+        fprintf(stderr, "%s: %s\n", caminho, erro);
+    } else if (construtorGerarHashPerfeita(&b) != 0) {
+        // catalogoAbrir() conta em falhasCarga, como um arquivo inválido
+        fprintf(stderr, "%s: caso '%s' sem hash perfeita para as %u pistas\n", caminho, nome, b.numPistas);
+    } else {
+        caso = construtorEmpacotar(&b, bytes);
+    }
+    fclose(f);
+    construtorLiberar(&b);
+    return caso;
+}
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef COLACAO_H
+#define COLACAO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------
+// colacao.h
+// Chaves de ordenação (collation keys) para textos em português (UTF-8).
+//
+// A chave é calculada uma vez por texto e depois comparada com memcmp, o que
+// dá a ordem alfabética correta ("Porão" antes de "Porta", "família" junto de
+// "familiar") com custo de comparação próximo ao de strcmp. Os níveis são:
+//   1. letra base sem acento e sem caixa ("Á" -> "a"), demais bytes como estão
+//   2. acento de cada caractere (sem acento < agudo < grave < circunflexo < til ...)
+//   3. caixa (minúscula < maiúscula)
+//   4. bytes originais (desempate: textos diferentes nunca têm a mesma chave)
+// Os níveis são separados pelo byte 0x01, menor que qualquer peso, então um
+// texto que é prefixo de outro vem antes dele. Os bytes 0x01 e 0x02 do
+// próprio texto viram, no nível 1, o par 0x02 0x02 / 0x02 0x03 (escape), e
+// assim nunca se confundem com o separador.
+// Cobre ASCII e Latin-1 (U+00C0..U+00FF); "ß" pesa como "ss" (desempatando
+// no nível 2). Outros caracteres ficam no fim, pela ordem dos seus bytes UTF-8.
+// -----------------------------
+
+#define COLACAO_SEPARADOR 0x01
+#define COLACAO_ESCAPE 0x02       // prefixo dos bytes 0x01 e 0x02 do texto no nível 1
+#define COLACAO_MAX_PILHA 512     // chaves até este tamanho cabem em buffer local
+
+// acentos (nível 2), já deslocados para não colidir com o separador
+enum {
+    ACENTO_NENHUM = 2, ACENTO_AGUDO, ACENTO_GRAVE, ACENTO_CIRCUNFLEXO, ACENTO_TIL,
+    ACENTO_TREMA, ACENTO_ANEL, ACENTO_CEDILHA, ACENTO_OUTRO
+};
+
+// letra base e acento de U+00C0..U+00DF; U+00E0..U+00FF repetem o padrão em minúsculas.
+// Base 0 = não é letra (×, ÷, Þ, þ): o caractere é tratado como "outro".
+static const char COLACAO_BASE[32] = {
+    'a','a','a','a','a','a','a','c','e','e','e','e','i','i','i','i',
+    'd','n','o','o','o','o','o', 0 ,'o','u','u','u','u','y', 0 ,'s'
+};
+static const unsigned char COLACAO_ACENTO[32] = {
+    ACENTO_GRAVE, ACENTO_AGUDO, ACENTO_CIRCUNFLEXO, ACENTO_TIL, ACENTO_TREMA, ACENTO_ANEL, ACENTO_OUTRO, ACENTO_CEDILHA,
+    ACENTO_GRAVE, ACENTO_AGUDO, ACENTO_CIRCUNFLEXO, ACENTO_TREMA, ACENTO_GRAVE, ACENTO_AGUDO, ACENTO_CIRCUNFLEXO, ACENTO_TREMA,
+    ACENTO_OUTRO, ACENTO_TIL, ACENTO_GRAVE, ACENTO_AGUDO, ACENTO_CIRCUNFLEXO, ACENTO_TIL, ACENTO_TREMA, ACENTO_NENHUM,
+    ACENTO_OUTRO, ACENTO_GRAVE, ACENTO_AGUDO, ACENTO_CIRCUNFLEXO, ACENTO_TREMA, ACENTO_AGUDO, ACENTO_NENHUM, ACENTO_OUTRO
+};
+
+// Pesos de um caractere. 'primario' aponta para os bytes do nível 1
+// (a própria sequência UTF-8 quando o caractere não é mapeado).
+typedef struct ColacaoPeso {
+    unsigned char letra;          // peso primário de 1 byte (0 = usar bytes originais)
+    unsigned char acento;
+    unsigned char caixa;
+    unsigned char dupla;          // 1: a letra conta duas vezes ("ß" = "ss")
+    size_t tamanho;               // bytes UTF-8 consumidos
+} ColacaoPeso;
+
+static inline ColacaoPeso colacaoPeso(const unsigned char *p) {
+    ColacaoPeso w = { 0, ACENTO_NENHUM, 2, 0, 1 };
+    unsigned char c = p[0];
+    if (c < 0x80) {
+        if (c >= 'A' && c <= 'Z') { w.letra = (unsigned char)(c - 'A' + 'a'); w.caixa = 3; }
+        else w.letra = c;
+        return w;
+    }
+    // sequência UTF-8 de 2 bytes em U+00C0..U+00FF: C3 80..C3 BF
+    if (c == 0xC3 && (p[1] & 0xC0) == 0x80) {
+        unsigned cp = 0xC0 + (p[1] & 0x3F);
+        unsigned i = cp & 0x1F;
+        w.tamanho = 2;
+        if (cp == 0xFF) { w.letra = 'y'; w.acento = ACENTO_TREMA; return w; }   // ÿ
+        if (COLACAO_BASE[i] == 0) return w;                                     // ×, Þ, ÷, þ
+        w.letra = (unsigned char) COLACAO_BASE[i];
+        w.acento = COLACAO_ACENTO[i];
+        if (cp < 0xE0 && cp != 0xDF) w.caixa = 3;                               // ß não tem maiúscula
+        if (cp == 0xDF) w.dupla = 1;                                            // ß = ss
+        return w;
+    }
+    // demais: avança a sequência UTF-8 inteira (ou 1 byte se inválida)
+    size_t n = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+    size_t k = 1;
+    while (k < n && (p[k] & 0xC0) == 0x80) k++;
+    w.tamanho = k;
+    return w;
+}
+
+// -----------------------------
+// colacaoChave()
+// Escreve a chave de 's' em 'dest' (até 'cap' bytes) e retorna o tamanho
+// necessário, como strxfrm. Se o retorno for maior que 'cap', a chave não
+// coube e o conteúdo de 'dest' deve ser descartado. O tamanho é no máximo
+// colacaoTamanhoMaximo(s) = 5 * strlen(s) + 3.
+// -----------------------------
+static inline size_t colacaoTamanhoMaximo(const char *s) {
+    return 5 * strlen(s) + 3;
+}
+
+static inline size_t colacaoChave(const char *s, unsigned char *dest, size_t cap) {
+    size_t n = 0;
+    #define COLACAO_EMITE(b) do { if (n < cap) dest[n] = (unsigned char)(b); n++; } while (0)
+
+    for (int nivel = 1; nivel <= 3; ++nivel) {
+        const unsigned char *p = (const unsigned char*) s;
+        while (*p) {
+            ColacaoPeso w = colacaoPeso(p);
+            if (nivel == 1) {
+                if (w.letra == COLACAO_SEPARADOR || w.letra == COLACAO_ESCAPE) {
+                    COLACAO_EMITE(COLACAO_ESCAPE);
+                    COLACAO_EMITE(w.letra + 1);
+                } else if (w.letra) {
+                    COLACAO_EMITE(w.letra);
+                    if (w.dupla) COLACAO_EMITE(w.letra);
+                } else {
+                    for (size_t k = 0; k < w.tamanho; ++k) COLACAO_EMITE(p[k]);
+                }
+            } else if (nivel == 2) {
+                if (w.dupla) COLACAO_EMITE(ACENTO_NENHUM);   // "ss" < "ß"
+                COLACAO_EMITE(w.acento);
+            } else {
+                if (w.dupla) COLACAO_EMITE(w.caixa);
+                COLACAO_EMITE(w.caixa);
+            }
+            p += w.tamanho;
+        }
+        COLACAO_EMITE(COLACAO_SEPARADOR);
+    }
+    for (const unsigned char *p = (const unsigned char*) s; *p; ++p) COLACAO_EMITE(*p);
+
+    #undef COLACAO_EMITE
+    return n;
+}
+
+// colacaoChaveAlocada: aloca e devolve a chave de 's' (tamanho em *tam)
+static inline unsigned char *colacaoChaveAlocada(const char *s, size_t *tam) {
+    size_t n = colacaoTamanhoMaximo(s);
+    unsigned char *chave = (unsigned char*) malloc(n);
+    if (!chave) {
+        fprintf(stderr, "Erro: sem memória para chave de ordenação.\n");
+        exit(EXIT_FAILURE);
+    }
+    *tam = colacaoChave(s, chave, n);
+    return chave;
+}
+
+// colacaoChaveEm: monta a chave de 's' uma única vez, em 'local' quando o
+// tamanho máximo cabe nele e numa alocação caso contrário. Quem chama
+// libera o resultado se ele for diferente de 'local'.
+static inline unsigned char *colacaoChaveEm(const char *s, unsigned char *local, size_t capLocal, size_t *tam) {
+    if (colacaoTamanhoMaximo(s) > capLocal) return colacaoChaveAlocada(s, tam);
+    *tam = colacaoChave(s, local, capLocal);
+    return local;
+}
+
+// colacaoCompara: compara duas chaves (mesma convenção de strcmp)
+static inline int colacaoCompara(const unsigned char *a, size_t tamA, const unsigned char *b, size_t tamB) {
+    int cmp = memcmp(a, b, tamA < tamB ? tamA : tamB);
+    if (cmp != 0) return cmp;
+    return (tamA > tamB) - (tamA < tamB);
+}
+
+#endif
@@ -0,0 +1,260 @@
+#ifndef DICIONARIO_PISTAS_H
+#define DICIONARIO_PISTAS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------
+// dicionario_pistas.h
+// Dicionário ordenado e compactado de pistas (somente leitura após montado).
+//
+// As pistas são gravadas em ordem, em blocos de DICIONARIO_BLOCO entradas
+// com codificação frontal (front coding):
+//   - a primeira pista do bloco é gravada inteira: [tamanho][bytes]
+//   - as demais gravam só o que muda: [prefixo comum][tamanho do sufixo][sufixo]
+// Os números usam varint (7 bits por byte). O índice amostrado guarda o
+// deslocamento do início de cada bloco, o que permite busca binária pelas
+// primeiras pistas e depois uma varredura curta dentro de um único bloco.
+// Listagem ordenada e busca exata funcionam direto sobre a forma compactada.
+//
+// A ordem é a dos bytes (strcmp), a do Nível Aventureiro e de
+// ORDEM_COLACAO=0. Não é a ordem do português que o Nível Mestre usa em
+// exibirPistas() (colacao.h): aqui "Porta" vem antes de "Porão" e as pistas
+// acentuadas ou com maiúscula ficam fora do lugar alfabético.
+// -----------------------------
+
+#define DICIONARIO_BLOCO 16
+
+typedef struct DicionarioPistas {
+    unsigned char *dados;     // blocos codificados
+    size_t tamDados, capDados;
+    size_t *blocos;           // índice amostrado: início de cada bloco em 'dados'
+    size_t numBlocos, capBlocos;
+    size_t numPistas;
+    size_t maiorPista;        // maior tamanho (para o buffer de listagem)
+    char *ultima;             // última pista acrescentada (só durante a montagem)
+    size_t tamUltima, capUltima;
+} DicionarioPistas;
+
+// -----------------------------
+// Utilitários
+// -----------------------------
+static inline void *dicionarioRealloc(void *p, size_t n) {
+    void *r = realloc(p, n ? n : 1);
+    if (!r) {
+        fprintf(stderr, "Erro: sem memória no dicionário de pistas.\n");
+        exit(EXIT_FAILURE);
+    }
+    return r;
+}
+
+static inline void dicionarioReserva(DicionarioPistas *d, size_t extra) {
+    if (d->tamDados + extra <= d->capDados) return;
+    size_t cap = d->capDados ? d->capDados : 4096;
+    while (d->tamDados + extra > cap) cap *= 2;
+    d->dados = (unsigned char*) dicionarioRealloc(d->dados, cap);
+    d->capDados = cap;
+}
+
+static inline void dicionarioEscreveVarint(DicionarioPistas *d, size_t v) {
+    dicionarioReserva(d, 10);
+    while (v >= 0x80) {
+        d->dados[d->tamDados++] = (unsigned char)(v | 0x80);
+        v >>= 7;
+    }
+    d->dados[d->tamDados++] = (unsigned char) v;
+}
+
+static inline size_t dicionarioLeVarint(const unsigned char **p) {
+    size_t v = 0;
+    int desloc = 0;
+    unsigned char c;
+    do {
+        c = *(*p)++;
+        v |= (size_t)(c & 0x7F) << desloc;
+        desloc += 7;
+    } while (c & 0x80);
+    return v;
+}
+
+// -----------------------------
+// Montagem
+// -----------------------------
+static inline void dicionarioInicializar(DicionarioPistas *d) {
+    memset(d, 0, sizeof(*d));
+}
+
+// -----------------------------
+// dicionarioAcrescentar()
+// Acrescenta uma pista ao final. As pistas devem chegar em ordem crescente
+// (strcmp); repetições da última são ignoradas.
+// Retorna 0 em sucesso ou -1 se a pista estiver fora de ordem.
+// -----------------------------
+static inline int dicionarioAcrescentar(DicionarioPistas *d, const char *pista) {
+    size_t tam = strlen(pista);
+    size_t comum = 0;
+
+    if (d->numPistas > 0) {
+        while (comum < tam && comum < d->tamUltima && pista[comum] == d->ultima[comum]) comum++;
+        if (comum == tam && comum == d->tamUltima) return 0;   // duplicata
+        // fora de ordem: 'pista' é prefixo da última ou difere com byte menor
+        if (comum == tam || (comum < d->tamUltima &&
+            (unsigned char) pista[comum] < (unsigned char) d->ultima[comum])) return -1;
+    }
+
+    if (d->numPistas % DICIONARIO_BLOCO == 0) {
+        if (d->numBlocos == d->capBlocos) {
+            d->capBlocos = d->capBlocos ? d->capBlocos * 2 : 64;
+            d->blocos = (size_t*) dicionarioRealloc(d->blocos, d->capBlocos * sizeof(size_t));
+        }
+        d->blocos[d->numBlocos++] = d->tamDados;
+        comum = 0;   // cabeça do bloco: gravada inteira
+        dicionarioEscreveVarint(d, tam);
+    } else {
+        dicionarioEscreveVarint(d, comum);
+        dicionarioEscreveVarint(d, tam - comum);
+    }
+    dicionarioReserva(d, tam - comum);
+    memcpy(d->dados + d->tamDados, pista + comum, tam - comum);
+    d->tamDados += tam - comum;
+
+    if (tam + 1 > d->capUltima) {
+        d->capUltima = (tam + 1) * 2;
+        d->ultima = (char*) dicionarioRealloc(d->ultima, d->capUltima);
+    }
+    memcpy(d->ultima + comum, pista + comum, tam - comum + 1);
+    d->tamUltima = tam;
+    if (tam > d->maiorPista) d->maiorPista = tam;
+    d->numPistas++;
+    return 0;
+}
+
+// -----------------------------
+// dicionarioFinalizar()
+// Encerra a montagem: libera o buffer da última pista e devolve a folga
+// das áreas de dados e do índice.
+// -----------------------------
+static inline void dicionarioFinalizar(DicionarioPistas *d) {
+    free(d->ultima);
+    d->ultima = NULL;
+    d->tamUltima = d->capUltima = 0;
+    if (d->tamDados) {
+        d->dados = (unsigned char*) dicionarioRealloc(d->dados, d->tamDados);
+        d->capDados = d->tamDados;
+    }
+    if (d->numBlocos) {
+        d->blocos = (size_t*) dicionarioRealloc(d->blocos, d->numBlocos * sizeof(size_t));
+        d->capBlocos = d->numBlocos;
+    }
+}
+
+static inline void dicionarioLiberar(DicionarioPistas *d) {
+    free(d->dados);
+    free(d->blocos);
+    free(d->ultima);
+    dicionarioInicializar(d);
+}
+
+// bytes ocupados pelo dicionário (dados + índice + cabeçalho)
+static inline size_t dicionarioBytes(const DicionarioPistas *d) {
+    return sizeof(*d) + d->capDados + d->capBlocos * sizeof(size_t) + d->capUltima;
+}
+
+// -----------------------------
+// dicionarioBuscar()
+// Busca exata. Retorna a posição da pista na ordem (0..numPistas-1) ou -1.
+// A varredura no bloco compara só a partir do prefixo já confirmado, sem
+// reconstruir as pistas.
+// -----------------------------
+
+// compara a chave com a cabeça do bloco b (ordem de strcmp)
+static inline int dicionarioComparaCabeca(const DicionarioPistas *d, size_t b, const char *chave, size_t tamChave) {
+    const unsigned char *p = d->dados + d->blocos[b];
+    size_t tam = dicionarioLeVarint(&p);
+    size_t n = tam < tamChave ? tam : tamChave;
+    int cmp = memcmp(chave, p, n);
+    if (cmp != 0) return cmp;
+    return (tamChave > tam) - (tamChave < tam);
+}
+
+static inline long dicionarioBuscar(const DicionarioPistas *d, const char *chave) {
+    if (!chave || d->numPistas == 0) return -1;
+    size_t tamChave = strlen(chave);
+
+    // último bloco cuja cabeça é <= chave
+    size_t lo = 0, hi = d->numBlocos;
+    while (hi - lo > 1) {
+        size_t meio = lo + (hi - lo) / 2;
+        if (dicionarioComparaCabeca(d, meio, chave, tamChave) < 0) hi = meio;
+        else lo = meio;
+    }
+
+    const unsigned char *p = d->dados + d->blocos[lo];
+    size_t fimBloco = (lo + 1) * DICIONARIO_BLOCO;
+    if (fimBloco > d->numPistas) fimBloco = d->numPistas;
+
+    // cabeça: 'iguais' = quantos bytes iniciais coincidem com a chave
+    size_t tam = dicionarioLeVarint(&p);
+    size_t iguais = 0;
+    while (iguais < tam && iguais < tamChave && p[iguais] == (unsigned char) chave[iguais]) iguais++;
+    if (iguais == tam && iguais == tamChave) return (long)(lo * DICIONARIO_BLOCO);
+    if (iguais < tam && (iguais == tamChave || (unsigned char) chave[iguais] < p[iguais])) return -1;
+    p += tam;
+
+    for (size_t i = lo * DICIONARIO_BLOCO + 1; i < fimBloco; ++i) {
+        size_t comum = dicionarioLeVarint(&p);
+        size_t tamSufixo = dicionarioLeVarint(&p);
+        if (comum < iguais) return -1;             // esta pista já passou da chave
+        if (comum == iguais) {
+            size_t k = 0;
+            while (k < tamSufixo && iguais + k < tamChave && p[k] == (unsigned char) chave[iguais + k]) k++;
+            iguais += k;
+            if (k == tamSufixo && iguais == tamChave) return (long) i;
+            if (k < tamSufixo && (iguais == tamChave || (unsigned char) chave[iguais] < p[k])) return -1;
+        }
+        // comum > iguais: continua menor que a chave, 'iguais' não muda
+        p += tamSufixo;
+    }
+    return -1;
+}
+
+// -----------------------------
+// dicionarioPercorrer()
+// Visita as pistas na ordem dos bytes, reconstruindo uma de cada vez em um
+// único buffer. A string passada ao visitante só vale durante a chamada.
+// -----------------------------
+typedef void (*DicionarioVisitante)(const char *pista, void *contexto);
+
+static inline void dicionarioPercorrer(const DicionarioPistas *d, DicionarioVisitante visitar, void *contexto) {
+    if (d->numPistas == 0) return;
+    char *atual = (char*) dicionarioRealloc(NULL, d->maiorPista + 1);
+    const unsigned char *p = d->dados;
+    for (size_t i = 0; i < d->numPistas; ++i) {
+        size_t comum = 0, tam;
+        if (i % DICIONARIO_BLOCO == 0) {
+            tam = dicionarioLeVarint(&p);
+        } else {
+            comum = dicionarioLeVarint(&p);
+            tam = comum + dicionarioLeVarint(&p);
+        }
+        memcpy(atual + comum, p, tam - comum);
+        atual[tam] = '\0';
+        p += tam - comum;
+        visitar(atual, contexto);
+    }
+    free(atual);
+}
+
+// visitante que imprime cada pista como exibirPistas() (" - <pista>")
+static inline void dicionarioImprimePista(const char *pista, void *contexto) {
+    (void) contexto;
+    printf(" - %s\n", pista);
+}
+
+// exibirDicionario: lista as pistas na ordem dos bytes
+static inline void exibirDicionario(const DicionarioPistas *d) {
+    dicionarioPercorrer(d, dicionarioImprimePista, NULL);
+}
+
+#endif
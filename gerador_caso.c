@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "caso_construtor.h"
+
+// -----------------------------
+// gerador_caso.c
+// Converte a descrição de um caso (ver formato em caso_construtor.h) em um
+// cabeçalho C com tabelas estáticas somente leitura: textos internados,
+// salas com índices dos filhos, suspeitos e hash perfeita pista -> suspeito.
+// O programa que inclui o cabeçalho não faz nenhuma alocação para montar o caso.
+//
+// Uso: gerador_caso <descricao.txt> <saida.h> <NOME>
+//   ex.: gerador_caso casos/mansao.txt caso_mansao.h CASO_MANSAO
+// -----------------------------
+
+// escreve um texto como literal C (bytes UTF-8 são mantidos como estão)
+static void escreveLiteral(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; ++s) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(out, "\\%c", c);
+        else if (c < 0x20) fprintf(out, "\\%03o", c);
+        else fputc(c, out);
+    }
+    fputs("\\0\"", out);
+}
+
+// escreve um índice/deslocamento, usando o nome simbólico quando ausente
+static void escreveIndice(FILE *out, uint32_t v) {
+    if (v == CASO_NENHUM) fputs("CASO_NENHUM", out);
+    else fprintf(out, "%u", v);
+}
+
+static void gerarCabecalho(FILE *out, const CasoConstrutor *b, const char *origem, const char *nome) {
+    fprintf(out, "// Gerado por gerador_caso.c a partir de %s. NÃO EDITAR.\n", origem);
+    fprintf(out, "#ifndef %s_H\n#define %s_H\n\n#include \"caso.h\"\n\n", nome, nome);
+
+    // textos internados: um literal por texto, na ordem dos deslocamentos
+    fprintf(out, "static const char %s_TEXTOS[%u] =\n", nome, b->tamTextos);
+    for (uint32_t off = 0; off < b->tamTextos; off += (uint32_t) strlen(b->textos + off) + 1) {
+        fprintf(out, "    /* %5u */ ", off);
+        escreveLiteral(out, b->textos + off);
+        fputc('\n', out);
+    }
+    fputs(";\n\n", out);
+
+    // salas: { nome, pista, esquerda, direita }
+    fprintf(out, "static const CasoSala %s_SALAS[%u] = {\n", nome, b->numSalas);
+    for (uint32_t i = 0; i < b->numSalas; ++i) {
+        const CasoSala *s = &b->salas[i];
+        fprintf(out, "    { %u, ", s->nome);
+        escreveIndice(out, s->pista);
+        fputs(", ", out);
+        escreveIndice(out, s->esquerda);
+        fputs(", ", out);
+        escreveIndice(out, s->direita);
+        fprintf(out, " },   // %u: %s\n", i, b->ids[i]);
+    }
+    fputs("};\n\n", out);
+
+    // arrays vazios não são válidos em C: mantém ao menos um elemento
+    fprintf(out, "static const uint32_t %s_SUSPEITOS[%u] = {", nome, b->numSuspeitos ? b->numSuspeitos : 1);
+    for (uint32_t i = 0; i < b->numSuspeitos; ++i) fprintf(out, "%s%u", i ? ", " : " ", b->suspeitos[i]);
+    fputs(b->numSuspeitos ? " };\n\n" : " 0 };\n\n", out);
+
+    fprintf(out, "static const uint32_t %s_DESLOCAMENTOS[%u] = {", nome, b->numBaldes);
+    for (uint32_t i = 0; i < b->numBaldes; ++i) fprintf(out, "%s%u", i ? ", " : " ", b->deslocamentos[i]);
+    fputs(" };\n\n", out);
+
+    fprintf(out, "static const CasoPista %s_PISTAS[%u] = {\n", nome, b->numPistas ? b->numPistas : 1);
+    for (uint32_t i = 0; i < b->numPistas; ++i)
+        fprintf(out, "    { %u, %u },\n", b->pistas[i].pista, b->pistas[i].suspeito);
+    if (b->numPistas == 0) fputs("    { 0, 0 },\n", out);
+    fputs("};\n\n", out);
+
+    fprintf(out, "static const Caso %s = {\n", nome);
+    fprintf(out, "    %s_TEXTOS,\n", nome);
+    fprintf(out, "    %s_SALAS, %u,\n", nome, b->numSalas);
+    fprintf(out, "    %s_SUSPEITOS, %u,\n", nome, b->numSuspeitos);
+    fprintf(out, "    %s_DESLOCAMENTOS, %u,\n", nome, b->numBaldes);
+    fprintf(out, "    %s_PISTAS, %u\n", nome, b->numPistas);
+    fputs("};\n\n#endif\n", out);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "Uso: %s <descricao.txt> <saida.h> <NOME>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    // identificador C: letras, dígitos e '_', não vazio e sem começar por dígito
+    if (argv[3][0] == '\0') {
+        fprintf(stderr, "Erro: NOME deve ser um identificador C válido.\n");
+        return EXIT_FAILURE;
+    }
+    for (const char *p = argv[3]; *p; ++p) {
+        if ((!isalnum((unsigned char)*p) && *p != '_') || (p == argv[3] && isdigit((unsigned char)*p))) {
+            fprintf(stderr, "Erro: NOME deve ser um identificador C válido.\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        fprintf(stderr, "Erro: não foi possível abrir %s.\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    CasoConstrutor b;
+    construtorInicializa(&b);
+    char erro[256];
+    int r = construtorLerArquivo(&b, in, erro, sizeof(erro));
+    fclose(in);
+    if (r != 0) {
+        fprintf(stderr, "%s: %s\n", argv[1], erro);
+        construtorLiberar(&b);
+        return EXIT_FAILURE;
+    }
+    if (construtorGerarHashPerfeita(&b) != 0) {
+        fprintf(stderr, "Erro: não foi possível gerar a hash perfeita.\n");
+        construtorLiberar(&b);
+        return EXIT_FAILURE;
+    }
+
+    // confere a hash gerada antes de escrever
+    Caso c = construtorComoCaso(&b);
+    for (uint32_t i = 0; i < b.numPistas; ++i) {
+        const char *p = b.textos + b.pistas[i].pista;
+        if (casoEncontrarSuspeito(&c, p) != b.textos + b.suspeitos[b.pistas[i].suspeito]) {
+            fprintf(stderr, "Erro interno: hash perfeita inconsistente para \"%s\".\n", p);
+            construtorLiberar(&b);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE *out = fopen(argv[2], "w");
+    if (!out) {
+        fprintf(stderr, "Erro: não foi possível criar %s.\n", argv[2]);
+        construtorLiberar(&b);
+        return EXIT_FAILURE;
+    }
+    gerarCabecalho(out, &b, argv[1], argv[3]);
+    fclose(out);
+
+    printf("%s: %u salas, %u pistas, %u suspeitos, %u bytes de texto.\n",
+           argv[2], b.numSalas, b.numPistas, b.numSuspeitos, b.tamTextos);
+    construtorLiberar(&b);
+    return 0;
+}
@@ -0,0 +1,565 @@
+#ifndef MOTOR_JOGO_H
+#define MOTOR_JOGO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "caso.h"
+
+// -----------------------------
+// motor_jogo.h
+// Núcleo comum dos três níveis: mapa de salas, laço de exploração, coleta
+// de pistas, tabela de suspeitos e regra do veredito. Cada nível é uma
+// fachada fina que escolhe os recursos em tempo de compilação, definindo
+// antes do #include:
+//   MOTOR_PISTAS     coleta de pistas em BST (Aventureiro, Mestre)
+//   MOTOR_SUSPEITOS  pista -> suspeito pela hash perfeita de um Caso (Mestre)
+//   MOTOR_VEREDITO   acusação e regra das MOTOR_LIMIAR_EVIDENCIAS (Mestre)
+// Sem nada definido, todos ficam ligados. Um recurso desligado não deixa
+// rastro: a Sala perde o campo da pista e o laço de exploração não tem o
+// trecho correspondente (#if, não if).
+//
+// O mapa guarda as salas em uma tabela contínua, com índices no lugar de
+// ponteiros e os nomes em um único bloco de textos (sem tamanho máximo de
+// nome). Um Caso (caso.h) pode ser usado diretamente como mapa.
+//
+// Ganchos opcionais (macros) para quem precisa interceptar o laço, como a
+// gravação de sessões do Nível Mestre:
+//   MOTOR_LER_ESCOLHA(contexto, &opc)   lê a tecla (1 = lida, 0 = inválida)
+//   MOTOR_PISTA_COLETADA(contexto, sala) chamada a cada pista nova
+//   MOTOR_TELA(...)                      saída do jogo (padrão: printf)
+//
+// Textos da exploração (MOTOR_TXT_*): cada nível pode definir os seus antes
+// do #include e manter as mensagens que sempre teve; os que ficarem sem
+// definição usam os padrões abaixo.
+// -----------------------------
+
+#ifndef MOTOR_PISTAS
+#define MOTOR_PISTAS 1
+#endif
+#ifndef MOTOR_SUSPEITOS
+#define MOTOR_SUSPEITOS MOTOR_PISTAS
+#endif
+#ifndef MOTOR_VEREDITO
+#define MOTOR_VEREDITO MOTOR_SUSPEITOS
+#endif
+#if MOTOR_SUSPEITOS && !MOTOR_PISTAS
+#error "MOTOR_SUSPEITOS exige MOTOR_PISTAS"
+#endif
+#if MOTOR_VEREDITO && !MOTOR_SUSPEITOS
+#error "MOTOR_VEREDITO exige MOTOR_SUSPEITOS"
+#endif
+
+#if MOTOR_PISTAS
+// ORDEM_COLACAO 1 (padrão): ordem alfabética do português ("Porão" < "Porta"),
+// com a chave de ordenação calculada uma vez por pista (colacao.h) e
+// comparada com memcmp. ORDEM_COLACAO 0: ordem dos bytes (strcmp).
+#ifndef ORDEM_COLACAO
+#define ORDEM_COLACAO 1
+#endif
+#include "percurso_arvore.h"
+#if ORDEM_COLACAO
+#include "colacao.h"
+#endif
+#endif
+
+#if MOTOR_SUSPEITOS
+#include "busca_suspeitos.h"
+#ifndef DISTANCIA_ACUSACAO
+#define DISTANCIA_ACUSACAO 2            // erros de digitação tolerados no nome acusado
+#endif
+#endif
+
+#if MOTOR_VEREDITO
+#ifndef MOTOR_LIMIAR_EVIDENCIAS
+#define MOTOR_LIMIAR_EVIDENCIAS 2       // pistas necessárias para sustentar a acusação
+#endif
+#endif
+
+#ifndef MOTOR_TELA
+#define MOTOR_TELA(...) printf(__VA_ARGS__)
+#endif
+#ifndef MOTOR_LER_ESCOLHA
+#define MOTOR_LER_ESCOLHA(contexto, opc) (scanf(" %c", (opc)) == 1)
+#endif
+#ifndef MOTOR_PISTA_COLETADA
+#define MOTOR_PISTA_COLETADA(contexto, sala) ((void) 0)
+#endif
+
+// textos da exploração (formatos de MOTOR_TELA; %s = nome da sala ou pista)
+#ifndef MOTOR_TXT_SALA
+#define MOTOR_TXT_SALA "\nVocê está em: %s\n"
+#endif
+#ifndef MOTOR_TXT_PISTA
+#define MOTOR_TXT_PISTA "Pista encontrada: \"%s\"\n"
+#endif
+#ifndef MOTOR_TXT_SEM_PISTA
+#define MOTOR_TXT_SEM_PISTA "Nenhuma pista nova aqui.\n"
+#endif
+#ifndef MOTOR_TXT_FIM_CAMINHO
+#define MOTOR_TXT_FIM_CAMINHO "Você chegou ao fim do caminho!\n"
+#endif
+#ifndef MOTOR_TXT_OPCOES
+#define MOTOR_TXT_OPCOES "\nOpções:\n"
+#endif
+#ifndef MOTOR_TXT_ESQUERDA
+#define MOTOR_TXT_ESQUERDA " (e) Ir para %s (esquerda)\n"
+#endif
+#ifndef MOTOR_TXT_DIREITA
+#define MOTOR_TXT_DIREITA " (d) Ir para %s (direita)\n"
+#endif
+#ifndef MOTOR_TXT_SAIR
+#define MOTOR_TXT_SAIR " (s) Sair da exploração\n"
+#endif
+#ifndef MOTOR_TXT_PROMPT
+#define MOTOR_TXT_PROMPT "Escolha: "
+#endif
+#ifndef MOTOR_TXT_ENTRADA_INVALIDA
+#define MOTOR_TXT_ENTRADA_INVALIDA "Entrada inválida. Tente novamente.\n"
+#endif
+#ifndef MOTOR_TXT_SEM_ESQUERDA
+#define MOTOR_TXT_SEM_ESQUERDA "Não há caminho à esquerda.\n"
+#endif
+#ifndef MOTOR_TXT_SEM_DIREITA
+#define MOTOR_TXT_SEM_DIREITA "Não há caminho à direita.\n"
+#endif
+#ifndef MOTOR_TXT_ENCERRADA
+#define MOTOR_TXT_ENCERRADA "Exploração encerrada pelo jogador.\n"
+#endif
+#ifndef MOTOR_TXT_OPCAO_INVALIDA
+#define MOTOR_TXT_OPCAO_INVALIDA "Opção inválida. Use 'e', 'd' ou 's'.\n"
+#endif
+
+#define SALA_NENHUMA CASO_NENHUM
+
+// -----------------------------
+// Estruturas
+// -----------------------------
+
+// Sala: com pistas é o próprio CasoSala (um Caso serve de mapa sem cópia)
+#if MOTOR_PISTAS
+typedef CasoSala Sala;
+#else
+typedef struct Sala {
+    uint32_t nome;       // deslocamento em 'textos'
+    uint32_t esquerda;   // índice da sala à esquerda (SALA_NENHUMA se não houver)
+    uint32_t direita;    // índice da sala à direita (SALA_NENHUMA se não houver)
+} Sala;
+#endif
+
+// Mapa: tabela de salas (a de índice 0 é a entrada) + textos.
+// Criado sala a sala com criarSala() ou emprestado de um Caso com mapaDoCaso().
+typedef struct Mapa {
+    const char *textos;
+    const Sala *salas;
+    uint32_t numSalas;
+    // armazenamento próprio (mapas montados com criarSala)
+    char *textosProprios;
+    size_t tamTextos, capTextos;
+    Sala *salasProprias;
+    uint32_t capSalas;
+} Mapa;
+
+#if MOTOR_PISTAS
+// Nó da BST que armazena pistas coletadas (sem duplicatas)
+// A pista aponta para o texto do mapa (não é copiada nem liberada).
+typedef struct PistaNode {
+    const char *pista;
+#if ORDEM_COLACAO
+    unsigned char *chave;   // chave de ordenação (alocada junto com o nó)
+    size_t tamChave;
+#endif
+    struct PistaNode *esq;
+    struct PistaNode *dir;
+} PistaNode;
+#endif
+
+// Estado de uma partida
+typedef struct Jogo {
+    const Mapa *mapa;
+#if MOTOR_PISTAS
+    PistaNode *pistas;      // BST de pistas coletadas
+#endif
+#if MOTOR_SUSPEITOS
+    const Caso *caso;       // tabela pista -> suspeito
+    IndiceSuspeitos suspeitos;  // nomes do caso para a acusação (montado na primeira)
+    int estadoSuspeitos;        // 0 = não montado, 1 = pronto, -1 = falhou
+#endif
+} Jogo;
+
+// -----------------------------
+// Mapa
+// -----------------------------
+static inline void mapaInicializar(Mapa *m) {
+    memset(m, 0, sizeof(*m));
+}
+
+static inline uint32_t mapaGuardaTexto(Mapa *m, const char *s) {
+    size_t n = strlen(s) + 1;
+    if (m->tamTextos + n > m->capTextos) {
+        m->capTextos = (m->capTextos + n) * 2;
+        m->textosProprios = (char*) realloc(m->textosProprios, m->capTextos);
+        if (!m->textosProprios) {
+            fprintf(stderr, "Erro ao alocar memória para o mapa.\n");
+            exit(EXIT_FAILURE);
+        }
+        m->textos = m->textosProprios;
+    }
+    memcpy(m->textosProprios + m->tamTextos, s, n);
+    m->tamTextos += n;
+    return (uint32_t)(m->tamTextos - n);
+}
+
+// -----------------------------
+// criarSala()
+// Acrescenta uma sala ao mapa (sem saídas) e retorna seu índice.
+// O nome (e a pista) são copiados para o bloco de textos do mapa.
+// -----------------------------
+#if MOTOR_PISTAS
+static inline uint32_t criarSala(Mapa *m, const char *nome, const char *pista) {
+#else
+static inline uint32_t criarSala(Mapa *m, const char *nome) {
+#endif
+    if (m->numSalas == m->capSalas) {
+        m->capSalas = m->capSalas ? m->capSalas * 2 : 8;
+        m->salasProprias = (Sala*) realloc(m->salasProprias, m->capSalas * sizeof(Sala));
+        if (!m->salasProprias) {
+            fprintf(stderr, "Erro ao alocar memória para a sala.\n");
+            exit(EXIT_FAILURE);
+        }
+        m->salas = m->salasProprias;
+    }
+    Sala *s = &m->salasProprias[m->numSalas];
+    s->nome = mapaGuardaTexto(m, nome);
+#if MOTOR_PISTAS
+    s->pista = (pista && pista[0]) ? mapaGuardaTexto(m, pista) : SALA_NENHUMA;
+#endif
+    s->esquerda = s->direita = SALA_NENHUMA;
+    return m->numSalas++;
+}
+
+// ligarSalas: define as saídas de uma sala (SALA_NENHUMA = sem saída)
+static inline void ligarSalas(Mapa *m, uint32_t sala, uint32_t esquerda, uint32_t direita) {
+    m->salasProprias[sala].esquerda = esquerda;
+    m->salasProprias[sala].direita = direita;
+}
+
+#if MOTOR_PISTAS
+// mapaDoCaso: usa as tabelas (somente leitura) de um caso como mapa, sem cópia
+static inline Mapa mapaDoCaso(const Caso *caso) {
+    Mapa m;
+    mapaInicializar(&m);
+    m.textos = caso->textos;
+    m.salas = caso->salas;
+    m.numSalas = caso->numSalas;
+    return m;
+}
+#endif
+
+// jogoInicializar: partida nova sobre 'mapa' (sem pistas; com suspeitos,
+// o chamador preenche 'caso'). Desfeita com liberarJogo().
+static inline void jogoInicializar(Jogo *jogo, const Mapa *mapa) {
+    memset(jogo, 0, sizeof(*jogo));
+    jogo->mapa = mapa;
+}
+
+// liberarSalas: libera o armazenamento próprio do mapa (nada para mapas de um Caso)
+static inline void liberarSalas(Mapa *m) {
+    free(m->textosProprios);
+    free(m->salasProprias);
+    mapaInicializar(m);
+}
+
+#if MOTOR_PISTAS
+// -----------------------------
+// Pistas coletadas
+// -----------------------------
+
+// comparaPista: pista procurada (chave já calculada, com colação) x nó
+#if ORDEM_COLACAO
+static inline int comparaPista(const unsigned char *chave, size_t tamChave, const PistaNode *n) {
+    return colacaoCompara(chave, tamChave, n->chave, n->tamChave);
+}
+#else
+static inline int comparaPista(const char *pista, const PistaNode *n) {
+    return strcmp(pista, n->pista);
+}
+#endif
+
+// -----------------------------
+// inserirPista()
+// Insere a pista na BST se ainda não estiver lá; retorna 1 se inseriu
+// (pista nova) e 0 se já tinha sido coletada. Uma única descida responde
+// às duas perguntas. Com colação, a chave é calculada uma única vez
+// (colacaoChaveEm: buffer local, ou alocação se a pista for muito longa) e
+// só é copiada para o nó se a pista for nova; repetida, nada é alocado.
+// A pista deve viver tanto quanto a árvore (texto do mapa).
+// -----------------------------
+static inline int inserirPista(PistaNode **raiz, const char *pista) {
+#if ORDEM_COLACAO
+    unsigned char local[COLACAO_MAX_PILHA];
+    size_t tamChave;
+    unsigned char *chave = colacaoChaveEm(pista, local, sizeof(local), &tamChave);
+#endif
+    PistaNode **pos = raiz;
+    while (*pos) {
+#if ORDEM_COLACAO
+        int cmp = comparaPista(chave, tamChave, *pos);
+#else
+        int cmp = comparaPista(pista, *pos);
+#endif
+        if (cmp == 0) break;
+        pos = cmp < 0 ? &(*pos)->esq : &(*pos)->dir;
+    }
+    int nova = *pos == NULL;
+    if (nova) {
+#if ORDEM_COLACAO
+        PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode) + tamChave);
+#else
+        PistaNode *n = (PistaNode*) malloc(sizeof(PistaNode));
+#endif
+        if (!n) {
+            fprintf(stderr, "Erro ao alocar nó de pista.\n");
+            exit(EXIT_FAILURE);
+        }
+        n->pista = pista;
+#if ORDEM_COLACAO
+        n->chave = (unsigned char*)(n + 1);
+        n->tamChave = tamChave;
+        memcpy(n->chave, chave, tamChave);
+#endif
+        n->esq = n->dir = NULL;
+        *pos = n;
+    }
+#if ORDEM_COLACAO
+    if (chave != local) free(chave);
+#endif
+    return nova;
+}
+
+// -----------------------------
+// exibirPistas()
+// Imprime as pistas coletadas em ordem (alfabética; com ORDEM_COLACAO,
+// acentos e maiúsculas seguem a ordem do português). Percurso de Morris
+// (percurso_arvore.h): sem recursão, qualquer profundidade.
+// -----------------------------
+static inline void imprimirPista(void *no, void *contexto) {
+    (void) no;   // MOTOR_TELA pode descartar os argumentos
+    (void) contexto;
+    MOTOR_TELA(" - %s\n", ((PistaNode*) no)->pista);
+}
+
+static inline void exibirPistas(PistaNode *raiz) {
+    arvoreEmOrdem(raiz, ARVORE_FILHOS(PistaNode, esq, dir), imprimirPista, NULL);
+}
+
+// liberarPistas: libera a BST sem recursão (chave na mesma alocação do nó)
+static inline void liberarPistas(PistaNode *raiz) {
+    arvoreLiberar(raiz, ARVORE_FILHOS(PistaNode, esq, dir), NULL, NULL);
+}
+#endif
+
+// -----------------------------
+// explorarSalas()
+// Navega interativamente pelo mapa a partir da sala 0.
+// Com MOTOR_PISTAS, a pista de cada sala é coletada automaticamente na
+// primeira visita; sem pistas, chegar a uma sala sem saídas encerra o passeio.
+// 'contexto' é repassado aos ganchos MOTOR_LER_ESCOLHA e MOTOR_PISTA_COLETADA.
+// -----------------------------
+static inline void explorarSalas(Jogo *jogo, void *contexto) {
+    const Mapa *mapa = jogo->mapa;
+    if (mapa->numSalas == 0) return;
+    char opc;
+    uint32_t pos = 0;
+    (void) contexto;
+
+    while (pos != SALA_NENHUMA) {
+        const Sala *sala = &mapa->salas[pos];
+        MOTOR_TELA(MOTOR_TXT_SALA, mapa->textos + sala->nome);
+
+#if MOTOR_PISTAS
+        // Se existir pista ainda não coletada, coleta automaticamente (insere na BST)
+        if (sala->pista != SALA_NENHUMA && inserirPista(&jogo->pistas, mapa->textos + sala->pista)) {
+            MOTOR_TELA(MOTOR_TXT_PISTA, mapa->textos + sala->pista);
+            MOTOR_PISTA_COLETADA(contexto, pos);
+        } else {
+            MOTOR_TELA(MOTOR_TXT_SEM_PISTA);
+        }
+#else
+        // Sala sem saídas (nó-folha): fim do passeio
+        if (sala->esquerda == SALA_NENHUMA && sala->direita == SALA_NENHUMA) {
+            MOTOR_TELA(MOTOR_TXT_FIM_CAMINHO);
+            break;
+        }
+#endif
+
+        // Mostra opções
+        MOTOR_TELA(MOTOR_TXT_OPCOES);
+        if (sala->esquerda != SALA_NENHUMA)
+            MOTOR_TELA(MOTOR_TXT_ESQUERDA, mapa->textos + mapa->salas[sala->esquerda].nome);
+        if (sala->direita != SALA_NENHUMA)
+            MOTOR_TELA(MOTOR_TXT_DIREITA, mapa->textos + mapa->salas[sala->direita].nome);
+        MOTOR_TELA(MOTOR_TXT_SAIR);
+        MOTOR_TELA(MOTOR_TXT_PROMPT);
+
+        if (!MOTOR_LER_ESCOLHA(contexto, &opc)) {
+            // entrada inválida: consumir resto e continuar
+            int ch;
+            while ((ch = getchar()) != '\n' && ch != EOF);
+            if (ch == EOF) break;
+            MOTOR_TELA(MOTOR_TXT_ENTRADA_INVALIDA);
+            continue;
+        }
+
+        if (opc == 'e' || opc == 'E') {
+            if (sala->esquerda != SALA_NENHUMA) pos = sala->esquerda;
+            else MOTOR_TELA(MOTOR_TXT_SEM_ESQUERDA);
+        } else if (opc == 'd' || opc == 'D') {
+            if (sala->direita != SALA_NENHUMA) pos = sala->direita;
+            else MOTOR_TELA(MOTOR_TXT_SEM_DIREITA);
+        } else if (opc == 's' || opc == 'S') {
+            MOTOR_TELA(MOTOR_TXT_ENCERRADA);
+            break;
+        } else {
+            MOTOR_TELA(MOTOR_TXT_OPCAO_INVALIDA);
+        }
+    }
+}
+
+#if MOTOR_SUSPEITOS
+// -----------------------------
+// Suspeitos
+// -----------------------------
+
+// contarEvidencias: quantas pistas coletadas apontam para o suspeito (hash perfeita do caso)
+typedef struct Acusacao {
+    const Caso *caso;
+    const char *suspeito;
+} Acusacao;
+
+static inline int pistaApontaSuspeito(const void *no, void *contexto) {
+    const Acusacao *a = (const Acusacao*) contexto;
+    const char *s = casoEncontrarSuspeito(a->caso, ((const PistaNode*) no)->pista);
+    return s && strcmp(s, a->suspeito) == 0;
+}
+
+static inline int contarEvidencias(const Jogo *jogo, const char *suspeito) {
+    Acusacao a = { jogo->caso, suspeito };
+    return (int) arvoreContar(jogo->pistas, ARVORE_FILHOS(PistaNode, esq, dir), pistaApontaSuspeito, &a);
+}
+
+// -----------------------------
+// interpretarSuspeito()
+// Aceita o nome digitado com erros de digitação, maiúsculas/minúsculas ou
+// acentos trocados: procura os suspeitos do caso a até DISTANCIA_ACUSACAO
+// edições (busca_suspeitos.h). Retorna o nome oficial se houver um único mais
+// próximo; em caso de empate lista os candidatos e retorna NULL.
+// O índice dos suspeitos é montado na primeira acusação e reaproveitado
+// nas seguintes até liberarJogo(). Se não puder ser montado, só o nome
+// exato é aceito.
+// -----------------------------
+static inline int prepararSuspeitos(Jogo *jogo) {
+    if (jogo->estadoSuspeitos == 0) {
+        const Caso *caso = jogo->caso;
+        indiceSuspeitosInicializar(&jogo->suspeitos);
+        for (uint32_t i = 0; i < caso->numSuspeitos; ++i) {
+            indiceSuspeitosAdicionar(&jogo->suspeitos, casoTexto(caso, caso->suspeitos[i]));
+        }
+        if (indiceSuspeitosConstruir(&jogo->suspeitos) == 0) {
+            jogo->estadoSuspeitos = 1;
+        } else {
+            fprintf(stderr, "Erro: não foi possível montar o índice de suspeitos; só nomes exatos serão aceitos.\n");
+            indiceSuspeitosLiberar(&jogo->suspeitos);
+            jogo->estadoSuspeitos = -1;
+        }
+    }
+    return jogo->estadoSuspeitos == 1;
+}
+
+static inline const char *interpretarSuspeito(Jogo *jogo, const char *entrada) {
+    const Caso *caso = jogo->caso;
+    if (!prepararSuspeitos(jogo)) {
+        for (uint32_t i = 0; i < caso->numSuspeitos; ++i) {
+            if (strcmp(casoTexto(caso, caso->suspeitos[i]), entrada) == 0) return entrada;
+        }
+        return NULL;
+    }
+
+    ResultadoSuspeito res[4];
+    int num = indiceSuspeitosBuscar(&jogo->suspeitos, entrada, DISTANCIA_ACUSACAO, res, 4);
+    const char *nome = NULL;
+    if (num == 1 || (num > 1 && res[1].distancia > res[0].distancia)) {
+        nome = casoTexto(caso, caso->suspeitos[res[0].indice]);
+    } else if (num > 1) {
+        MOTOR_TELA("Nome ambíguo. Você quis dizer:");
+        for (int i = 0; i < num && res[i].distancia == res[0].distancia; ++i) {
+            MOTOR_TELA("%s%s", i ? ", " : " ", res[i].nome);
+        }
+        MOTOR_TELA("?\n");
+    }
+    return nome;
+}
+#endif
+
+#if MOTOR_VEREDITO
+// -----------------------------
+// Veredito
+// -----------------------------
+enum { VEREDITO_NENHUM = 0, VEREDITO_FRACO, VEREDITO_SUSTENTADO };
+
+typedef struct Julgamento {
+    char suspeito[128];     // nome considerado (oficial, se reconhecido)
+    int evidencias;
+    int veredito;
+} Julgamento;
+
+// -----------------------------
+// julgarAcusacao()
+// Interpreta o nome acusado, conta as evidências e aplica a regra: a
+// acusação se sustenta com pelo menos MOTOR_LIMIAR_EVIDENCIAS pistas.
+// Imprime o resultado e o devolve em 'j'.
+// -----------------------------
+static inline void julgarAcusacao(Jogo *jogo, const char *entrada, Julgamento *j) {
+    j->suspeito[0] = '\0';
+    j->evidencias = 0;
+    j->veredito = VEREDITO_NENHUM;
+    if (entrada[0] == '\0') {
+        MOTOR_TELA("Nenhum suspeito informado. Encerrando.\n");
+        return;
+    }
+    const char *oficial = interpretarSuspeito(jogo, entrada);
+    if (oficial && strcmp(oficial, entrada) != 0) MOTOR_TELA("Interpretado como: %s\n", oficial);
+    snprintf(j->suspeito, sizeof(j->suspeito), "%s", oficial ? oficial : entrada);
+    j->evidencias = contarEvidencias(jogo, j->suspeito);
+
+    MOTOR_TELA("\nVocê acusou: %s\n", j->suspeito);
+    MOTOR_TELA("Evidências encontradas que apontam para %s: %d\n", j->suspeito, j->evidencias);
+    if (j->evidencias >= MOTOR_LIMIAR_EVIDENCIAS) {
+        j->veredito = VEREDITO_SUSTENTADO;
+        MOTOR_TELA("\nResultado: ACUSAÇÃO SUSTENTADA. Parece que você tem evidências suficientes!\n");
+    } else {
+        j->veredito = VEREDITO_FRACO;
+        MOTOR_TELA("\nResultado: ACUSAÇÃO FRACA. Poucas evidências. Falta prova contundente.\n");
+    }
+}
+#endif
+
+// -----------------------------
+// liberarJogo()
+// Libera o que a partida alocou: pistas coletadas e índice de suspeitos.
+// O mapa é de quem o criou (liberarSalas).
+// -----------------------------
+static inline void liberarJogo(Jogo *jogo) {
+#if MOTOR_PISTAS
+    liberarPistas(jogo->pistas);
+    jogo->pistas = NULL;
+#endif
+#if MOTOR_SUSPEITOS
+    if (jogo->estadoSuspeitos == 1) indiceSuspeitosLiberar(&jogo->suspeitos);
+    jogo->estadoSuspeitos = 0;
+#endif
+    (void) jogo;
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef PERCURSO_ARVORE_H
+#define PERCURSO_ARVORE_H
+
+#include <stdlib.h>
+#include <stddef.h>
+
+// -----------------------------
+// percurso_arvore.h
+// Percursos de árvores binárias sem recursão e sem pilha: funcionam com
+// qualquer profundidade (um corredor de um milhão de salas, uma BST de
+// pistas degenerada em lista) usando memória extra constante.
+//
+// As funções são genéricas: recebem o nó como void* e os deslocamentos dos
+// campos dos filhos, obtidos com ARVORE_FILHOS(tipo, esq, dir). Exemplo:
+//   arvoreEmOrdem(raiz, ARVORE_FILHOS(PistaNode, esq, dir), imprimir, NULL);
+//
+// - arvoreEmOrdem / arvoreContar: percurso de Morris. Os ponteiros vazios da
+//   direita viram "fios" temporários para o sucessor e são restaurados antes
+//   do fim, então a árvore volta exatamente ao que era. Durante o percurso o
+//   visitante não deve seguir os ponteiros dos filhos nem alterar a árvore.
+// - arvoreLiberar: rotações à direita transformam a árvore em uma lista
+//   pela direita, liberada nó a nó.
+// Cada nó é visitado um número constante de vezes (O(n) no total).
+// -----------------------------
+
+#define ARVORE_FILHOS(tipo, esq, dir) offsetof(tipo, esq), offsetof(tipo, dir)
+
+typedef void (*ArvoreVisitante)(void *no, void *contexto);
+typedef int (*ArvorePredicado)(const void *no, void *contexto);
+
+// campo de filho de um nó (deslocamento em bytes)
+static inline void **arvoreFilho(void *no, size_t deslocamento) {
+    return (void**)((char*) no + deslocamento);
+}
+
+// -----------------------------
+// arvoreEmOrdem()
+// Visita os nós em ordem (esquerda, nó, direita) sem recursão.
+// -----------------------------
+static inline void arvoreEmOrdem(void *raiz, size_t offEsq, size_t offDir,
+                                 ArvoreVisitante visitar, void *contexto) {
+    void *atual = raiz;
+    while (atual) {
+        void *esq = *arvoreFilho(atual, offEsq);
+        if (!esq) {
+            visitar(atual, contexto);
+            atual = *arvoreFilho(atual, offDir);
+            continue;
+        }
+        // predecessor: nó mais à direita da subárvore esquerda
+        void *pred = esq;
+        while (*arvoreFilho(pred, offDir) && *arvoreFilho(pred, offDir) != atual) {
+            pred = *arvoreFilho(pred, offDir);
+        }
+        if (*arvoreFilho(pred, offDir) == NULL) {
+            *arvoreFilho(pred, offDir) = atual;   // fio até o sucessor; desce à esquerda
+            atual = esq;
+        } else {
+            *arvoreFilho(pred, offDir) = NULL;    // esquerda concluída: desfaz o fio
+            visitar(atual, contexto);
+            atual = *arvoreFilho(atual, offDir);
+        }
+    }
+}
+
+// -----------------------------
+// arvoreContar()
+// Conta os nós para os quais 'predicado' retorna verdadeiro (em ordem).
+// -----------------------------
+typedef struct ArvoreContagem {
+    ArvorePredicado predicado;
+    void *contexto;
+    size_t total;
+} ArvoreContagem;
+
+static inline void arvoreContaNo(void *no, void *contexto) {
+    ArvoreContagem *c = (ArvoreContagem*) contexto;
+    if (c->predicado(no, c->contexto)) c->total++;
+}
+
+static inline size_t arvoreContar(void *raiz, size_t offEsq, size_t offDir,
+                                  ArvorePredicado predicado, void *contexto) {
+    ArvoreContagem c = { predicado, contexto, 0 };
+    arvoreEmOrdem(raiz, offEsq, offDir, arvoreContaNo, &c);
+    return c.total;
+}
+
+// -----------------------------
+// arvoreLiberar()
+// Libera todos os nós. 'liberar' recebe cada nó (e 'contexto') e deve
+// liberar o nó e o que ele possuir; se for NULL, cada nó é liberado com free().
+// -----------------------------
+static inline void arvoreLiberar(void *raiz, size_t offEsq, size_t offDir,
+                                 ArvoreVisitante liberar, void *contexto) {
+    void *atual = raiz;
+    while (atual) {
+        void *esq = *arvoreFilho(atual, offEsq);
+        if (esq) {
+            // rotação à direita: o filho esquerdo sobe e 'atual' vira seu filho direito
+            *arvoreFilho(atual, offEsq) = *arvoreFilho(esq, offDir);
+            *arvoreFilho(esq, offDir) = atual;
+            atual = esq;
+        } else {
+            void *dir = *arvoreFilho(atual, offDir);
+            if (liberar) liberar(atual, contexto);
+            else free(atual);
+            atual = dir;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef TRILHA_SESSAO_H
+#define TRILHA_SESSAO_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+// nanosleep é POSIX: quem inclui este cabeçalho precisa definir
+// _POSIX_C_SOURCE antes de qualquer #include do sistema
+#if defined(__GLIBC__) && !defined(_POSIX_C_SOURCE)
+#error "defina _POSIX_C_SOURCE 200809L antes dos #include para usar trilha_sessao.h"
+#endif
+
+// -----------------------------
+// trilha_sessao.h
+// Gravação de sessões de jogo em uma trilha binária compacta, para repeti-las
+// depois (como carga de benchmark e como conferência de resultados).
+//
+// Formato (números em varint, 7 bits por byte; textos = tamanho + bytes):
+//   cabeçalho: "DQT1", nome do caso (vazio = caso estático)
+//   eventos:   tipo (1 byte), microssegundos desde o evento anterior, dados:
+//     TRILHA_ESCOLHA        tecla digitada na exploração (1 byte)
+//     TRILHA_PISTA          sala cuja pista foi coletada
+//     TRILHA_PISTAS_FINAIS  número de pistas coletadas + resumo (8 bytes)
+//     TRILHA_ACUSACAO       texto digitado na acusação
+//     TRILHA_VEREDITO       evidências, veredito (1 byte), suspeito considerado
+// O resumo das pistas finais é a soma dos FNV-1a de 64 bits dos textos:
+// não depende da ordem da árvore, então builds que ordenam as pistas de
+// formas diferentes continuam comparáveis.
+// -----------------------------
+
+#define TRILHA_MAGICO "DQT1"
+
+enum {
+    TRILHA_ESCOLHA = 1,
+    TRILHA_PISTA,
+    TRILHA_PISTAS_FINAIS,
+    TRILHA_ACUSACAO,
+    TRILHA_VEREDITO
+};
+
+typedef struct TrilhaEvento {
+    int tipo;
+    uint64_t tempo;      // microssegundos desde o início da sessão
+    uint64_t valor;      // tecla, sala, número de pistas ou evidências
+    uint64_t extra;      // resumo das pistas ou veredito
+    char *texto;         // acusação ou suspeito (NULL nos demais)
+} TrilhaEvento;
+
+typedef struct Trilha {
+    char *nomeCaso;      // "" = caso estático
+    TrilhaEvento *eventos;
+    size_t numEventos, capEventos;
+} Trilha;
+
+typedef struct TrilhaGravador {
+    FILE *arquivo;
+    uint64_t inicio, ultimo;
+} TrilhaGravador;
+
+// -----------------------------
+// Tempo
+// -----------------------------
+static inline uint64_t trilhaAgora(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t) ts.tv_sec * 1000000u + (uint64_t) ts.tv_nsec / 1000u;
+}
+
+static inline void trilhaEspera(uint64_t micros) {
+    if (micros == 0) return;
+#if defined(_WIN32)
+    Sleep((DWORD)(micros / 1000u));
+#else
+    struct timespec ts;
+    ts.tv_sec = (time_t)(micros / 1000000u);
+    ts.tv_nsec = (long)(micros % 1000000u) * 1000L;
+    nanosleep(&ts, NULL);
+#endif
+}
+
+// FNV-1a de 64 bits de um texto (parcela do resumo das pistas finais)
+static inline uint64_t trilhaResumoTexto(const char *s) {
+    uint64_t h = 14695981039346656037ULL;
+    for (const unsigned char *p = (const unsigned char*) s; *p; ++p) h = (h ^ *p) * 1099511628211ULL;
+    return h;
+}
+
+// -----------------------------
+// Gravação
+// -----------------------------
+static inline void trilhaEscreveVarint(FILE *f, uint64_t v) {
+    while (v >= 0x80) {
+        fputc((int)((v & 0x7F) | 0x80), f);
+        v >>= 7;
+    }
+    fputc((int) v, f);
+}
+
+static inline void trilhaEscreveTexto(FILE *f, const char *s) {
+    size_t n = s ? strlen(s) : 0;
+    trilhaEscreveVarint(f, n);
+    if (n) fwrite(s, 1, n, f);
+}
+
+// trilhaGravadorAbrir: escreve o cabeçalho; o relógio da sessão começa aqui
+static inline void trilhaGravadorAbrir(TrilhaGravador *g, FILE *arquivo, const char *nomeCaso) {
+    g->arquivo = arquivo;
+    g->inicio = g->ultimo = trilhaAgora();
+    fwrite(TRILHA_MAGICO, 1, 4, arquivo);
+    trilhaEscreveTexto(arquivo, nomeCaso);
+}
+
+// trilhaGravar: acrescenta um evento ('tempo' do evento é ignorado: usa o relógio)
+static inline void trilhaGravar(TrilhaGravador *g, const TrilhaEvento *e) {
+    uint64_t agora = trilhaAgora();
+    FILE *f = g->arquivo;
+    fputc(e->tipo, f);
+    trilhaEscreveVarint(f, agora >= g->ultimo ? agora - g->ultimo : 0);
+    g->ultimo = agora;
+    switch (e->tipo) {
+    case TRILHA_ESCOLHA:
+        fputc((int)(e->valor & 0xFF), f);
+        break;
+    case TRILHA_PISTA:
+        trilhaEscreveVarint(f, e->valor);
+        break;
+    case TRILHA_PISTAS_FINAIS:
+        trilhaEscreveVarint(f, e->valor);
+        for (int i = 0; i < 8; ++i) fputc((int)((e->extra >> (8 * i)) & 0xFF), f);
+        break;
+    case TRILHA_ACUSACAO:
+        trilhaEscreveTexto(f, e->texto);
+        break;
+    case TRILHA_VEREDITO:
+        trilhaEscreveVarint(f, e->valor);
+        fputc((int)(e->extra & 0xFF), f);
+        trilhaEscreveTexto(f, e->texto);
+        break;
+    }
+}
+
+// -----------------------------
+// Leitura
+// -----------------------------
+static inline int trilhaLeVarint(FILE *f, uint64_t *v) {
+    uint64_t r = 0;
+    for (int desloc = 0; desloc < 64; desloc += 7) {
+        int c = fgetc(f);
+        if (c == EOF) return -1;
+        r |= (uint64_t)(c & 0x7F) << desloc;
+        if (!(c & 0x80)) {
+            *v = r;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static inline char *trilhaLeTexto(FILE *f) {
+    uint64_t n;
+    if (trilhaLeVarint(f, &n) != 0 || n > (1u << 20)) return NULL;
+    char *s = (char*) malloc((size_t) n + 1);
+    if (!s) {
+        fprintf(stderr, "Erro: sem memória para ler a trilha.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (fread(s, 1, (size_t) n, f) != (size_t) n) {
+        free(s);
+        return NULL;
+    }
+    s[n] = '\0';
+    return s;
+}
+
+static inline void trilhaLiberar(Trilha *t) {
+    for (size_t i = 0; i < t->numEventos; ++i) free(t->eventos[i].texto);
+    free(t->eventos);
+    free(t->nomeCaso);
+    memset(t, 0, sizeof(*t));
+}
+
+// -----------------------------
+// trilhaCarregar()
+// Lê uma trilha inteira para a memória (a repetição não faz E/S de disco).
+// Retorna 0, ou -1 com a descrição do problema em 'erro'.
+// -----------------------------
+static inline int trilhaCarregar(FILE *f, Trilha *t, char *erro, size_t tamErro) {
+    memset(t, 0, sizeof(*t));
+    char magico[4];
+    if (fread(magico, 1, 4, f) != 4 || memcmp(magico, TRILHA_MAGICO, 4) != 0) {
+        snprintf(erro, tamErro, "não é uma trilha %s", TRILHA_MAGICO);
+        return -1;
+    }
+    if (!(t->nomeCaso = trilhaLeTexto(f))) {
+        snprintf(erro, tamErro, "cabeçalho truncado");
+        return -1;
+    }
+
+    uint64_t tempo = 0;
+    int tipo;
+    while ((tipo = fgetc(f)) != EOF) {
+        TrilhaEvento e = { tipo, 0, 0, 0, NULL };
+        uint64_t delta;
+        int ok = trilhaLeVarint(f, &delta) == 0;
+        int c;
+        switch (tipo) {
+        case TRILHA_ESCOLHA:
+            ok = ok && (c = fgetc(f)) != EOF;
+            if (ok) e.valor = (uint64_t) c;
+            break;
+        case TRILHA_PISTA:
+            ok = ok && trilhaLeVarint(f, &e.valor) == 0;
+            break;
+        case TRILHA_PISTAS_FINAIS:
+            ok = ok && trilhaLeVarint(f, &e.valor) == 0;
+            for (int i = 0; ok && i < 8; ++i) {
+                ok = (c = fgetc(f)) != EOF;
+                if (ok) e.extra |= (uint64_t) c << (8 * i);
+            }
+            break;
+        case TRILHA_ACUSACAO:
+            ok = ok && (e.texto = trilhaLeTexto(f)) != NULL;
+            break;
+        case TRILHA_VEREDITO:
+            ok = ok && trilhaLeVarint(f, &e.valor) == 0 && (c = fgetc(f)) != EOF;
+            if (ok) e.extra = (uint64_t) c;
+            ok = ok && (e.texto = trilhaLeTexto(f)) != NULL;
+            break;
+        default:
+            snprintf(erro, tamErro, "evento %zu: tipo desconhecido %d", t->numEventos, tipo);
+            trilhaLiberar(t);
+            return -1;
+        }
+        if (!ok) {
+            snprintf(erro, tamErro, "evento %zu truncado", t->numEventos);
+            free(e.texto);
+            trilhaLiberar(t);
+            return -1;
+        }
+        tempo += delta;
+        e.tempo = tempo;
+        if (t->numEventos == t->capEventos) {
+            t->capEventos = t->capEventos ? t->capEventos * 2 : 64;
+            TrilhaEvento *novo = (TrilhaEvento*) realloc(t->eventos, t->capEventos * sizeof(TrilhaEvento));
+            if (!novo) {
+                fprintf(stderr, "Erro: sem memória para ler a trilha.\n");
+                exit(EXIT_FAILURE);
+            }
+            t->eventos = novo;
+        }
+        t->eventos[t->numEventos++] = e;
+    }
+    return 0;
+}
+
+#endif